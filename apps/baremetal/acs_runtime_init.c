@@ -93,6 +93,12 @@ acs_load_execution_policy_defaults(acs_execution_policy_t *policy)
       policy->crypto_support = defaults->crypto_support;
       policy->sys_last_lvl_cache = defaults->sys_last_lvl_cache;
       policy->el1skiptrap_mask = defaults->el1skiptrap_mask;
+      policy->pcie_cfg_cache = defaults->pcie_cfg_cache;
+      policy->pcie_parallel_enum = defaults->pcie_parallel_enum;
+      policy->parallel_rules = defaults->parallel_rules;
+      policy->heap_test_arena = defaults->heap_test_arena;
+      policy->pe_fanout = defaults->pe_fanout;
+      policy->pe_worker_pool = defaults->pe_worker_pool;
   }
 
   platform_defaults = acs_get_platform_execution_policy_defaults();
@@ -106,6 +112,12 @@ acs_load_execution_policy_defaults(acs_execution_policy_t *policy)
   policy->crypto_support = platform_defaults->crypto_support;
   policy->sys_last_lvl_cache = platform_defaults->sys_last_lvl_cache;
   policy->el1skiptrap_mask = platform_defaults->el1skiptrap_mask;
+  policy->pcie_cfg_cache = platform_defaults->pcie_cfg_cache;
+  policy->pcie_parallel_enum = platform_defaults->pcie_parallel_enum;
+  policy->parallel_rules = platform_defaults->parallel_rules;
+  policy->heap_test_arena = platform_defaults->heap_test_arena;
+  policy->pe_fanout = platform_defaults->pe_fanout;
+  policy->pe_worker_pool = platform_defaults->pe_worker_pool;
 
   if (platform_defaults->timeout_pass != 0u)
       policy->timeout_pass = platform_defaults->timeout_pass;
@@ -1004,6 +1004,36 @@ command_init (void)
         policy->pcie_cache_present = FALSE;
     }
 
+    if (ShellCommandLineGetFlag (ParamPackage, L"-pcie_cfg_cache")) {
+        policy->pcie_cfg_cache = TRUE;
+    } else {
+        policy->pcie_cfg_cache = FALSE;
+    }
+
+    if (ShellCommandLineGetFlag (ParamPackage, L"-pcie_par_enum")) {
+        policy->pcie_parallel_enum = TRUE;
+    } else {
+        policy->pcie_parallel_enum = FALSE;
+    }
+
+    if (ShellCommandLineGetFlag (ParamPackage, L"-par_rules")) {
+        policy->parallel_rules = TRUE;
+    } else {
+        policy->parallel_rules = FALSE;
+    }
+
+    if (ShellCommandLineGetFlag (ParamPackage, L"-pe_fanout")) {
+        policy->pe_fanout = TRUE;
+    } else {
+        policy->pe_fanout = FALSE;
+    }
+
+    if (ShellCommandLineGetFlag (ParamPackage, L"-pe_pool")) {
+        policy->pe_worker_pool = TRUE;
+    } else {
+        policy->pe_worker_pool = FALSE;
+    }
+
     /* -el1skiptrap <params>: skip specific EL1 register accesses known to trap under hypervisors */
     CmdLineArg  = ShellCommandLineGetValue (ParamPackage, L"-el1skiptrap");
     if (CmdLineArg != NULL) {
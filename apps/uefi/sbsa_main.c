@@ -41,6 +41,11 @@ CONST SHELL_PARAM_ITEM ParamList[] = {
     {L"-no_crypto_ext", TypeFlag},
     {L"-only", TypeValue},
     {L"-p2p", TypeFlag},
+    {L"-par_rules", TypeFlag},
+    {L"-pcie_cfg_cache", TypeFlag},
+    {L"-pcie_par_enum", TypeFlag},
+    {L"-pe_fanout", TypeFlag},
+    {L"-pe_pool", TypeFlag},
     {L"-r", TypeValue},
     {L"-skip", TypeValue},
     {L"-skip-dp-nic-ms", TypeFlag},
@@ -79,6 +84,16 @@ HelpMsg (VOID)
         "-only <n> \n"
         "        Only run tests for rules at level <n> \n"
         "-p2p    Pass this flag to indicate that PCIe Hierarchy Supports Peer-to-Peer\n"
+        "-par_rules\n"
+        "        Run PE-local rules on idle secondary PEs\n"
+        "-pcie_cfg_cache\n"
+        "        Shadow read-only PCIe config registers to reduce ECAM accesses\n"
+        "-pcie_par_enum\n"
+        "        Probe PCIe ECAM buses on all PEs during enumeration\n"
+        "-pe_fanout\n"
+        "        Wake secondary PEs of multi-PE tests in a tree\n"
+        "-pe_pool\n"
+        "        Park secondary PEs between payloads instead of powering them off\n"
         "-r      Run tests for passed comma-separated Rule IDs or a rules file\n"
         "        Examples: -r B_PE_01,B_PE_02,B_GIC_01\n"
         "                  -r rules.txt  (file may mix commas/newlines; lines \n"
@@ -0,0 +1,71 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef __PAL_HEAP_H__
+#define __PAL_HEAP_H__
+
+#include "acs_stdint.h"
+
+/* Heap pages are handed out by a buddy allocator, blocks of order n are
+   (HEAP_PAGE_SIZE << n) bytes and aligned to their size */
+#define HEAP_PAGE_SHIFT         12
+#define HEAP_PAGE_SIZE          (1ull << HEAP_PAGE_SHIFT)
+#define HEAP_MAX_ORDER          18
+
+/* Small objects come from one page slabs of 16 to 1024 byte objects */
+#define HEAP_SLAB_MIN_SHIFT     4
+#define HEAP_SLAB_NUM_CLASSES   7
+#define HEAP_SLAB_HDR_SIZE      64
+
+/* Allocations made while an arena is open are carved from 64 KB chunks */
+#define HEAP_ARENA_CHUNK_ORDER  4
+
+/* Each PE keeps up to HEAP_MAG_SIZE freed objects per slab class in a
+   magazine, PEs whose linear index is HEAP_NUM_PE_CACHES or more go straight
+   to the slabs */
+#define HEAP_NUM_PE_CACHES      64
+#define HEAP_MAG_SIZE           16
+
+/* Debug check rejecting a slab object freed while already free, at the cost
+   of a walk of its slab freelist and of the magazine of the running PE */
+#ifndef HEAP_CHECK_DOUBLE_FREE
+#define HEAP_CHECK_DOUBLE_FREE  1
+#endif
+
+typedef struct {
+    uint64_t heap_size;          /* Bytes managed by the buddy allocator */
+    uint64_t bytes_in_use;       /* Bytes of the pages currently handed out */
+    uint64_t high_water;         /* Largest bytes_in_use seen */
+    uint64_t free_bytes;         /* Bytes in free buddy blocks */
+    uint64_t largest_free;       /* Size of the largest free buddy block */
+    uint32_t fragmentation;      /* Percentage of free_bytes outside largest_free */
+    uint32_t live_allocs;        /* Allocations not yet freed */
+    uint32_t alloc_failures;     /* Requests which returned NULL */
+    uint32_t arena_releases;     /* Arenas released */
+} pal_heap_stats_t;
+
+void     pal_heap_init(uint64_t base, uint64_t size);
+void    *pal_heap_alloc(uint64_t alignment, uint64_t size);
+void     pal_heap_free(void *ptr);
+uint32_t pal_heap_arena_open(void);
+uint64_t pal_heap_arena_release(void);
+void     pal_heap_persist_begin(void);
+void     pal_heap_persist_end(void);
+void     pal_heap_get_stats(pal_heap_stats_t *stats);
+void     pal_heap_set_multi_pe(void);
+
+#endif /* __PAL_HEAP_H__ */
@@ -54,6 +54,17 @@ typedef struct {
 #define UART_PL011_UARTCR_TX_EN_MASK       (0x1u << UART_PL011_UARTCR_TXE_OFF)
 #define UART_PL011_UARTFR_TX_FIFO_FULL_OFF 0x5u
 #define UART_PL011_UARTFR_TX_FIFO_FULL     (0x1u << UART_PL011_UARTFR_TX_FIFO_FULL_OFF)
+#define UART_PL011_UARTFR_TX_FIFO_EMPTY_OFF 0x7u
+#define UART_PL011_UARTFR_TX_FIFO_EMPTY    (0x1u << UART_PL011_UARTFR_TX_FIFO_EMPTY_OFF)
+
+/* Depth of the transmit FIFO, 32 bytes from PL011 r1p5 and 16 bytes before. It is
+   read from UARTPeriphID2 at init unless the target defines UART_PL011_TX_FIFO_DEPTH */
+#define UART_PL011_UARTPERIPHID2_OFF       0xFE8u
+#define UART_PL011_PERIPHID2_REV_SHIFT     0x4u
+#define UART_PL011_PERIPHID2_REV_MASK      0xFu
+#define UART_PL011_REV_R1P5                0x3u
+#define UART_PL011_TX_FIFO_DEPTH_R1P5      32
+#define UART_PL011_TX_FIFO_DEPTH_MIN       16
 
 #define UART_PL011_INTR_TX_OFF             0x5u
 #define UART_PL011_TX_INTR_MASK            (0x1u << UART_PL011_INTR_TX_OFF)
@@ -69,6 +80,8 @@ typedef struct {
 
 /* function prototypes */
 extern void pal_driver_uart_pl011_putc(int c);
+extern void pal_driver_uart_pl011_write(const char *buf, uint32_t len);
 void pal_uart_putc(char c);
+void pal_uart_write(const char *buf, uint32_t len);
 
 #endif /* _PAL_UART_PL011_H_ */
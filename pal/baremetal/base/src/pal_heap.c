@@ -0,0 +1,846 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_common_support.h"
+#include "pal_heap.h"
+
+/* State of each managed page, kind in the upper bits and block order below */
+#define HEAP_PG_ORDER_MASK   0x1F
+#define HEAP_PG_KIND_MASK    0xE0
+#define HEAP_PG_NONE         0x00  /* Page inside a block */
+#define HEAP_PG_FREE         0x20  /* First page of a free block */
+#define HEAP_PG_BLOCK        0x40  /* First page of an allocated block */
+#define HEAP_PG_SLAB         0x60  /* Page holding a slab */
+#define HEAP_PG_ARENA        0x80  /* Page of a block owned by the arena */
+
+#define HEAP_SLAB_MAX_OBJ    (1ull << (HEAP_SLAB_MIN_SHIFT + HEAP_SLAB_NUM_CLASSES - 1))
+#define HEAP_ARENA_CHUNK     (HEAP_PAGE_SIZE << HEAP_ARENA_CHUNK_ORDER)
+
+typedef struct heap_free_block {
+    struct heap_free_block *next;
+    struct heap_free_block *prev;
+} heap_free_block_t;
+
+typedef struct heap_slab {
+    struct heap_slab *next;      /* Slabs of the class with free objects */
+    struct heap_slab *prev;
+    void     *free_obj;          /* Freed objects, linked through their first word */
+    uint16_t  bump;              /* Objects from here on were never handed out */
+    uint16_t  in_use;
+    uint16_t  capacity;
+    uint8_t   size_class;
+} heap_slab_t;
+
+typedef struct heap_arena_block {
+    struct heap_arena_block *next;
+    uint64_t base;
+    uint32_t order;
+} heap_arena_block_t;
+
+/* Slab objects cached by one PE, only touched by that PE */
+typedef struct {
+    uint32_t count[HEAP_SLAB_NUM_CLASSES];
+    void    *obj[HEAP_SLAB_NUM_CLASSES][HEAP_MAG_SIZE];
+} heap_magazine_t;
+
+uint64_t PalGetMaxMpidr(void);
+
+static struct {
+    uint64_t base;               /* First managed page, after the page state array */
+    uint64_t end;
+    uint8_t *page_state;
+    heap_free_block_t *free_list[HEAP_MAX_ORDER + 1];
+    heap_slab_t *slab_list[HEAP_SLAB_NUM_CLASSES];
+    uint8_t  arena_active;
+    uint32_t persist_depth;      /* Open pal_heap_persist_begin() calls */
+    heap_arena_block_t *arena_blocks;
+    uint64_t arena_cur;
+    uint64_t arena_top;
+    uint32_t arena_allocs;
+    uint64_t pages_in_use;
+    uint64_t pages_high_water;
+    uint32_t live_allocs;
+    uint32_t alloc_failures;
+    uint32_t arena_releases;
+    heap_magazine_t *mag[HEAP_NUM_PE_CACHES];
+} g_heap;
+
+/* Ticket lock serialising the buddy, slab and arena state once secondary PEs
+   have been started, see pal_heap_set_multi_pe() */
+static volatile uint32_t g_heap_ticket_next;
+static volatile uint32_t g_heap_ticket_serving;
+static volatile uint32_t g_heap_multi_pe;
+
+static void heap_lock(void)
+{
+    uint32_t ticket;
+
+    if (!g_heap_multi_pe)
+        return;
+
+    ticket = __atomic_fetch_add(&g_heap_ticket_next, 1, __ATOMIC_RELAXED);
+    while (__atomic_load_n(&g_heap_ticket_serving, __ATOMIC_ACQUIRE) != ticket)
+        ;
+}
+
+static void heap_unlock(void)
+{
+    if (!g_heap_multi_pe)
+        return;
+
+    __atomic_store_n(&g_heap_ticket_serving, g_heap_ticket_serving + 1, __ATOMIC_RELEASE);
+}
+
+/* Counters are updated outside the lock by the slab path. Like the lock, the
+   atomics are only used once secondary PEs run, exclusives need the MMU on */
+static void heap_count_add(uint32_t *counter, uint32_t delta)
+{
+    if (g_heap_multi_pe)
+        __atomic_fetch_add(counter, delta, __ATOMIC_RELAXED);
+    else
+        *counter += delta;
+}
+
+static void heap_count_allocs(int32_t delta)
+{
+    heap_count_add(&g_heap.live_allocs, (uint32_t)delta);
+}
+
+static uint32_t heap_page_index(uint64_t addr)
+{
+    return (uint32_t)((addr - g_heap.base) >> HEAP_PAGE_SHIFT);
+}
+
+/**
+ * @brief  Smallest order whose block holds the requested number of bytes.
+ **/
+static uint32_t heap_order_for(uint64_t bytes)
+{
+    uint32_t order = 0;
+
+    while (order <= HEAP_MAX_ORDER && (HEAP_PAGE_SIZE << order) < bytes)
+        order++;
+
+    return order;
+}
+
+static void heap_list_push(uint32_t order, uint64_t addr)
+{
+    heap_free_block_t *blk = (heap_free_block_t *)(uintptr_t)addr;
+
+    blk->prev = NULL;
+    blk->next = g_heap.free_list[order];
+    if (blk->next)
+        blk->next->prev = blk;
+    g_heap.free_list[order] = blk;
+}
+
+static void heap_list_remove(uint32_t order, heap_free_block_t *blk)
+{
+    if (blk->prev)
+        blk->prev->next = blk->next;
+    else
+        g_heap.free_list[order] = blk->next;
+
+    if (blk->next)
+        blk->next->prev = blk->prev;
+}
+
+/**
+ * @brief  Return a block to the free lists, merging it with its free buddies.
+ *
+ * Blocks are aligned to their size, so the buddy of a block is found by
+ * flipping the address bit of its size. A buddy outside the managed range
+ * ends the merge.
+ **/
+static void heap_block_release(uint64_t addr, uint32_t order)
+{
+    uint64_t buddy;
+    uint32_t idx;
+
+    g_heap.page_state[heap_page_index(addr)] = HEAP_PG_NONE;
+
+    while (order < HEAP_MAX_ORDER) {
+        buddy = addr ^ (HEAP_PAGE_SIZE << order);
+        if (buddy < g_heap.base || buddy + (HEAP_PAGE_SIZE << order) > g_heap.end)
+            break;
+
+        idx = heap_page_index(buddy);
+        if (g_heap.page_state[idx] != (HEAP_PG_FREE | order))
+            break;
+
+        heap_list_remove(order, (heap_free_block_t *)(uintptr_t)buddy);
+        g_heap.page_state[idx] = HEAP_PG_NONE;
+        addr &= ~(HEAP_PAGE_SIZE << order);
+        order++;
+    }
+
+    g_heap.page_state[heap_page_index(addr)] = HEAP_PG_FREE | order;
+    heap_list_push(order, addr);
+}
+
+/**
+ * @brief  Take a block of the given order, splitting a larger one if needed.
+ * @return Block address, 0 if no block is large enough.
+ **/
+static uint64_t heap_block_alloc(uint32_t order)
+{
+    heap_free_block_t *blk;
+    uint64_t addr, buddy;
+    uint32_t cur = order;
+
+    while (cur <= HEAP_MAX_ORDER && g_heap.free_list[cur] == NULL)
+        cur++;
+
+    if (cur > HEAP_MAX_ORDER)
+        return 0;
+
+    blk = g_heap.free_list[cur];
+    heap_list_remove(cur, blk);
+    addr = (uint64_t)(uintptr_t)blk;
+    g_heap.page_state[heap_page_index(addr)] = HEAP_PG_NONE;
+
+    /* Give the upper halves back until the block has the requested order */
+    while (cur > order) {
+        cur--;
+        buddy = addr + (HEAP_PAGE_SIZE << cur);
+        g_heap.page_state[heap_page_index(buddy)] = HEAP_PG_FREE | cur;
+        heap_list_push(cur, buddy);
+    }
+
+    g_heap.pages_in_use += 1ull << order;
+    if (g_heap.pages_in_use > g_heap.pages_high_water)
+        g_heap.pages_high_water = g_heap.pages_in_use;
+
+    return addr;
+}
+
+static void heap_block_free(uint64_t addr, uint32_t order)
+{
+    g_heap.pages_in_use -= 1ull << order;
+    heap_block_release(addr, order);
+}
+
+static void heap_slab_link(heap_slab_t *slab)
+{
+    slab->prev = NULL;
+    slab->next = g_heap.slab_list[slab->size_class];
+    if (slab->next)
+        slab->next->prev = slab;
+    g_heap.slab_list[slab->size_class] = slab;
+}
+
+static void heap_slab_unlink(heap_slab_t *slab)
+{
+    if (slab->prev)
+        slab->prev->next = slab->next;
+    else
+        g_heap.slab_list[slab->size_class] = slab->next;
+
+    if (slab->next)
+        slab->next->prev = slab->prev;
+
+    slab->next = NULL;
+    slab->prev = NULL;
+}
+
+/**
+ * @brief  Allocate an object of the given size class from a slab.
+ *
+ * Objects start HEAP_SLAB_HDR_SIZE bytes into the page, so each object is
+ * aligned to the smaller of its size and HEAP_SLAB_HDR_SIZE.
+ **/
+static void *heap_slab_alloc(uint32_t size_class)
+{
+    heap_slab_t *slab = g_heap.slab_list[size_class];
+    uint64_t obj_size = 1ull << (size_class + HEAP_SLAB_MIN_SHIFT);
+    uint64_t page;
+    void *obj;
+
+    if (slab == NULL) {
+        page = heap_block_alloc(0);
+        if (page == 0)
+            return NULL;
+
+        g_heap.page_state[heap_page_index(page)] = HEAP_PG_SLAB;
+        slab = (heap_slab_t *)(uintptr_t)page;
+        slab->free_obj = NULL;
+        slab->bump = 0;
+        slab->in_use = 0;
+        slab->capacity = (uint16_t)((HEAP_PAGE_SIZE - HEAP_SLAB_HDR_SIZE) / obj_size);
+        slab->size_class = (uint8_t)size_class;
+        heap_slab_link(slab);
+    }
+
+    if (slab->free_obj) {
+        obj = slab->free_obj;
+        slab->free_obj = *(void **)obj;
+    } else {
+        obj = (void *)((uintptr_t)slab + HEAP_SLAB_HDR_SIZE + slab->bump * obj_size);
+        slab->bump++;
+    }
+
+    if (++slab->in_use == slab->capacity)
+        heap_slab_unlink(slab);
+
+    return obj;
+}
+
+static void heap_slab_free(heap_slab_t *slab, void *obj)
+{
+    if (slab->in_use == slab->capacity)
+        heap_slab_link(slab);
+
+    *(void **)obj = slab->free_obj;
+    slab->free_obj = obj;
+    slab->in_use--;
+
+    /* Keep the page unless another slab of the class has room */
+    if (slab->in_use == 0 && (slab->next || slab->prev)) {
+        heap_slab_unlink(slab);
+        heap_block_free((uint64_t)(uintptr_t)slab, 0);
+    }
+}
+
+/**
+ * @brief  Linear index of the running PE, computed like the index which picks
+ *         its secondary stack in ModuleEntryPoint.
+ **/
+static uint32_t heap_pe_slot(void)
+{
+    uint64_t mpidr, max, num_aff0, num_aff1, num_aff2;
+
+    asm volatile("mrs %0, mpidr_el1" : "=r"(mpidr));
+    max = PalGetMaxMpidr();
+
+    num_aff0 = (max & 0xFF) + 1;
+    num_aff1 = ((max >> 8) & 0xFF) + 1;
+    num_aff2 = ((max >> 16) & 0xFF) + 1;
+
+    return (uint32_t)((mpidr & 0xFF) +
+                      num_aff0 * (((mpidr >> 8) & 0xFF) +
+                      num_aff1 * (((mpidr >> 16) & 0xFF) +
+                      num_aff2 * ((mpidr >> 32) & 0xFF))));
+}
+
+/**
+ * @brief  Magazine of the running PE, created on first use from the largest
+ *         slab class.
+ * @return Magazine, NULL if the PE has none and gets none.
+ **/
+static heap_magazine_t *heap_pe_magazine(void)
+{
+    uint32_t slot = heap_pe_slot();
+    heap_magazine_t *mag;
+    uint32_t i;
+
+    if (slot >= HEAP_NUM_PE_CACHES)
+        return NULL;
+
+    mag = g_heap.mag[slot];
+    if (mag)
+        return mag;
+
+    heap_lock();
+    mag = heap_slab_alloc(HEAP_SLAB_NUM_CLASSES - 1);
+    heap_unlock();
+    if (mag == NULL)
+        return NULL;
+
+    for (i = 0; i < HEAP_SLAB_NUM_CLASSES; i++)
+        mag->count[i] = 0;
+
+    g_heap.mag[slot] = mag;
+    return mag;
+}
+
+/**
+ * @brief  Allocate a slab object, from the magazine of the running PE when it
+ *         holds one. An empty magazine is refilled to half its size while the
+ *         heap lock is held for the request.
+ **/
+static void *heap_small_alloc(uint32_t size_class)
+{
+    heap_magazine_t *mag = heap_pe_magazine();
+    uint32_t *count;
+    void *obj, *extra;
+
+    if (mag && mag->count[size_class])
+        return mag->obj[size_class][--mag->count[size_class]];
+
+    heap_lock();
+    obj = heap_slab_alloc(size_class);
+    if (obj && mag) {
+        count = &mag->count[size_class];
+        while (*count < HEAP_MAG_SIZE / 2) {
+            extra = heap_slab_alloc(size_class);
+            if (extra == NULL)
+                break;
+            mag->obj[size_class][(*count)++] = extra;
+        }
+    }
+    heap_unlock();
+
+    return obj;
+}
+
+#if HEAP_CHECK_DOUBLE_FREE
+/**
+ * @brief  Check that a slab object may be freed: it starts an object the slab
+ *         handed out and is neither on the slab freelist nor in the magazine
+ *         of the running PE. Magazines of other PEs are not looked at, they
+ *         change under the check.
+ * @return 1 if the object is already free or not an object, 0 otherwise.
+ **/
+static uint32_t heap_small_is_free(heap_slab_t *slab, heap_magazine_t *mag, void *obj)
+{
+    uint64_t obj_size = 1ull << (slab->size_class + HEAP_SLAB_MIN_SHIFT);
+    uint64_t offset = (uintptr_t)obj - (uintptr_t)slab;
+    uint32_t found = 0;
+    uint32_t i;
+    void *cur;
+
+    if (offset < HEAP_SLAB_HDR_SIZE || ((offset - HEAP_SLAB_HDR_SIZE) % obj_size))
+        return 1;
+
+    for (i = 0; mag && i < mag->count[slab->size_class]; i++) {
+        if (mag->obj[slab->size_class][i] == obj)
+            return 1;
+    }
+
+    heap_lock();
+    if ((offset - HEAP_SLAB_HDR_SIZE) / obj_size >= slab->bump)
+        found = 1;
+    for (cur = slab->free_obj; cur && !found; cur = *(void **)cur)
+        found = (cur == obj);
+    heap_unlock();
+
+    return found;
+}
+#endif
+
+/**
+ * @brief  Free a slab object into the magazine of the running PE. A full
+ *         magazine first hands half its objects back to their slabs.
+ * @return 0 if the object was freed, 1 if it was rejected as already free.
+ **/
+static uint32_t heap_small_free(heap_slab_t *slab, void *obj)
+{
+    heap_magazine_t *mag = heap_pe_magazine();
+    uint32_t size_class = slab->size_class;
+    uint32_t *count;
+    void *old;
+
+#if HEAP_CHECK_DOUBLE_FREE
+    if (heap_small_is_free(slab, mag, obj)) {
+        pal_print_msg(ACS_PRINT_ERR, "\n       Heap: double free of 0x%llx ignored",
+                      (uint64_t)(uintptr_t)obj);
+        return 1;
+    }
+#endif
+
+    if (mag == NULL) {
+        heap_lock();
+        heap_slab_free(slab, obj);
+        heap_unlock();
+        return 0;
+    }
+
+    count = &mag->count[size_class];
+    if (*count == HEAP_MAG_SIZE) {
+        heap_lock();
+        while (*count > HEAP_MAG_SIZE / 2) {
+            old = mag->obj[size_class][--(*count)];
+            heap_slab_free((heap_slab_t *)((uintptr_t)old & ~(HEAP_PAGE_SIZE - 1)), old);
+        }
+        heap_unlock();
+    }
+
+    mag->obj[size_class][(*count)++] = obj;
+    return 0;
+}
+
+static void heap_mark_arena(uint64_t base, uint32_t order)
+{
+    uint32_t idx = heap_page_index(base);
+    uint32_t i;
+
+    for (i = 0; i < (1u << order); i++)
+        g_heap.page_state[idx + i] = HEAP_PG_ARENA | order;
+}
+
+/**
+ * @brief  Allocate from the open arena.
+ *
+ * Requests are carved from HEAP_ARENA_CHUNK byte chunks, larger requests get a
+ * buddy block of their own. Every chunk and block is recorded on arena_blocks
+ * so pal_heap_arena_release() can hand them back together.
+ **/
+static void *heap_arena_alloc(uint64_t alignment, uint64_t size)
+{
+    heap_arena_block_t *blk;
+    uint64_t addr, base;
+    uint32_t order;
+    uint8_t  own_block;
+
+    addr = (g_heap.arena_cur + alignment - 1) & ~(alignment - 1);
+    if (g_heap.arena_cur && addr + size <= g_heap.arena_top) {
+        g_heap.arena_cur = addr + size;
+        return (void *)(uintptr_t)addr;
+    }
+
+    own_block = (size + alignment > HEAP_ARENA_CHUNK / 4);
+    order = own_block ? heap_order_for((size > alignment) ? size : alignment)
+                      : HEAP_ARENA_CHUNK_ORDER;
+    if (order > HEAP_MAX_ORDER)
+        return NULL;
+
+    base = heap_block_alloc(order);
+    if (base == 0)
+        return NULL;
+
+    heap_mark_arena(base, order);
+
+    if (own_block) {
+        /* The record of the block is carved from the current chunk */
+        blk = heap_arena_alloc(sizeof(uint64_t), sizeof(heap_arena_block_t));
+        if (blk == NULL) {
+            heap_block_free(base, order);
+            return NULL;
+        }
+        addr = base;
+    } else {
+        /* The record of a chunk sits at its start */
+        blk = (heap_arena_block_t *)(uintptr_t)base;
+        g_heap.arena_cur = base + sizeof(heap_arena_block_t);
+        g_heap.arena_top = base + HEAP_ARENA_CHUNK;
+        addr = (g_heap.arena_cur + alignment - 1) & ~(alignment - 1);
+        g_heap.arena_cur = addr + size;
+    }
+
+    blk->base = base;
+    blk->order = order;
+    blk->next = g_heap.arena_blocks;
+    g_heap.arena_blocks = blk;
+
+    return (void *)(uintptr_t)addr;
+}
+
+/**
+ * @brief  Initialise the heap over the given memory range.
+ *
+ * The page state array is placed at the start of the range and the rest is
+ * split into the largest size aligned blocks that fit.
+ *
+ * @param  base  Base address of the heap region.
+ * @param  size  Size of the heap region in bytes.
+ **/
+void pal_heap_init(uint64_t base, uint64_t size)
+{
+    uint64_t start = (base + HEAP_PAGE_SIZE - 1) & ~(HEAP_PAGE_SIZE - 1);
+    uint64_t end = (base + size) & ~(HEAP_PAGE_SIZE - 1);
+    uint64_t num_pages, state_pages, addr, i;
+    uint32_t order;
+    uint8_t *clear = (uint8_t *)&g_heap;
+
+    for (i = 0; i < sizeof(g_heap); i++)
+        clear[i] = 0;
+
+    if (end <= start)
+        return;
+
+    num_pages = (end - start) >> HEAP_PAGE_SHIFT;
+    state_pages = (num_pages + HEAP_PAGE_SIZE - 1) >> HEAP_PAGE_SHIFT;
+    if (state_pages >= num_pages)
+        return;
+
+    g_heap.page_state = (uint8_t *)(uintptr_t)start;
+    g_heap.base = start + (state_pages << HEAP_PAGE_SHIFT);
+    g_heap.end = end;
+
+    for (i = 0; i < num_pages - state_pages; i++)
+        g_heap.page_state[i] = HEAP_PG_NONE;
+
+    addr = g_heap.base;
+    while (addr < end) {
+        order = HEAP_MAX_ORDER;
+        while (order && ((addr & ((HEAP_PAGE_SIZE << order) - 1)) ||
+                         (addr + (HEAP_PAGE_SIZE << order) > end)))
+            order--;
+
+        g_heap.page_state[heap_page_index(addr)] = HEAP_PG_FREE | order;
+        heap_list_push(order, addr);
+        addr += HEAP_PAGE_SIZE << order;
+    }
+}
+
+/**
+ * @brief  Whether new allocations are owned by the open arena.
+ **/
+static uint32_t heap_arena_in_use(void)
+{
+    return g_heap.arena_active && (g_heap.persist_depth == 0);
+}
+
+/**
+ * @brief  Allocate memory from the heap.
+ *
+ * With an arena open the memory is owned by the arena, unless the request is
+ * made between pal_heap_persist_begin() and pal_heap_persist_end(). Otherwise
+ * requests of
+ * up to HEAP_SLAB_MAX_OBJ bytes with an alignment of at most
+ * HEAP_SLAB_HDR_SIZE come from a slab through the magazine of the running PE,
+ * the rest from the buddy allocator.
+ *
+ * @param  alignment  Alignment of the returned address, a power of 2.
+ * @param  size       Size of the allocation in bytes.
+ * @return Allocated address, NULL on failure.
+ **/
+void *pal_heap_alloc(uint64_t alignment, uint64_t size)
+{
+    uint64_t need = (size > alignment) ? size : alignment;
+    uint64_t addr;
+    uint32_t size_class, order;
+    void *ptr = NULL;
+
+    if (g_heap.page_state == NULL || size == 0 ||
+        alignment == 0 || (alignment & (alignment - 1)))
+        return NULL;
+
+    if (!heap_arena_in_use() && alignment <= HEAP_SLAB_HDR_SIZE &&
+        need <= HEAP_SLAB_MAX_OBJ) {
+        size_class = 0;
+        while ((1ull << (size_class + HEAP_SLAB_MIN_SHIFT)) < need)
+            size_class++;
+        ptr = heap_small_alloc(size_class);
+        if (ptr)
+            heap_count_allocs(1);
+        else
+            heap_count_add(&g_heap.alloc_failures, 1);
+        return ptr;
+    }
+
+    heap_lock();
+
+    if (heap_arena_in_use()) {
+        ptr = heap_arena_alloc(alignment, size);
+        if (ptr)
+            g_heap.arena_allocs++;
+    } else {
+        order = heap_order_for(need);
+        if (order <= HEAP_MAX_ORDER) {
+            addr = heap_block_alloc(order);
+            if (addr) {
+                g_heap.page_state[heap_page_index(addr)] = HEAP_PG_BLOCK | order;
+                ptr = (void *)(uintptr_t)addr;
+            }
+        }
+    }
+
+    if (ptr == NULL)
+        heap_count_add(&g_heap.alloc_failures, 1);
+
+    heap_unlock();
+
+    if (ptr)
+        heap_count_allocs(1);
+
+    return ptr;
+}
+
+/**
+ * @brief  Free memory returned by pal_heap_alloc().
+ *
+ * Arena memory is only returned by pal_heap_arena_release(), freeing it
+ * earlier is ignored. So are addresses which were not allocated and, with
+ * HEAP_CHECK_DOUBLE_FREE, slab objects which are already free.
+ *
+ * @param  ptr  Address to be freed.
+ **/
+void pal_heap_free(void *ptr)
+{
+    uint64_t addr = (uint64_t)(uintptr_t)ptr;
+    uint64_t page = addr & ~(HEAP_PAGE_SIZE - 1);
+    uint8_t  state;
+
+    if (g_heap.page_state == NULL || addr < g_heap.base || addr >= g_heap.end)
+        return;
+
+    /* The state of a page does not change while an allocation in it is live */
+    state = g_heap.page_state[heap_page_index(page)];
+
+    switch (state & HEAP_PG_KIND_MASK) {
+    case HEAP_PG_SLAB:
+        if (heap_small_free((heap_slab_t *)(uintptr_t)page, ptr))
+            return;
+        break;
+    case HEAP_PG_BLOCK:
+        if (addr != page)
+            return;
+        heap_lock();
+        heap_block_free(page, state & HEAP_PG_ORDER_MASK);
+        heap_unlock();
+        break;
+    default:
+        return;
+    }
+
+    heap_count_allocs(-1);
+}
+
+/**
+ * @brief  Open an arena, allocations are owned by it until it is released.
+ *
+ * An arena which is still open is left open, its memory is not released
+ * under allocations which may still be in use.
+ * @return 0 if the arena was opened, 1 if one was already open.
+ **/
+uint32_t pal_heap_arena_open(void)
+{
+    uint32_t was_open;
+
+    heap_lock();
+    was_open = g_heap.arena_active;
+    g_heap.arena_active = 1;
+    heap_unlock();
+
+    return was_open;
+}
+
+/**
+ * @brief  Start allocations which outlive the open arena.
+ *
+ * Data created on first use and kept across tests, such as lookup tables and
+ * pools, is allocated between this call and pal_heap_persist_end() so that
+ * releasing the arena does not free it. Calls nest.
+ **/
+void pal_heap_persist_begin(void)
+{
+    heap_lock();
+    g_heap.persist_depth++;
+    heap_unlock();
+}
+
+/**
+ * @brief  End allocations started by pal_heap_persist_begin().
+ **/
+void pal_heap_persist_end(void)
+{
+    heap_lock();
+    if (g_heap.persist_depth)
+        g_heap.persist_depth--;
+    heap_unlock();
+}
+
+/**
+ * @brief  Close the open arena and free everything allocated in it.
+ * @return Number of bytes handed back to the buddy allocator.
+ **/
+uint64_t pal_heap_arena_release(void)
+{
+    heap_arena_block_t *blk;
+    heap_arena_block_t *next;
+    uint64_t released = 0;
+    uint64_t base;
+    uint32_t order, idx, i;
+
+    heap_lock();
+
+    if (!g_heap.arena_active) {
+        heap_unlock();
+        return 0;
+    }
+
+    blk = g_heap.arena_blocks;
+
+    /* Records are listed newest first, so the record of a block is read before
+       the chunk holding it is freed */
+    while (blk) {
+        next = blk->next;
+        base = blk->base;
+        order = blk->order;
+
+        idx = heap_page_index(base);
+        for (i = 0; i < (1u << order); i++)
+            g_heap.page_state[idx + i] = HEAP_PG_NONE;
+
+        heap_block_free(base, order);
+        released += HEAP_PAGE_SIZE << order;
+        blk = next;
+    }
+
+    heap_count_allocs(-(int32_t)g_heap.arena_allocs);
+    g_heap.arena_allocs = 0;
+    g_heap.arena_blocks = NULL;
+    g_heap.arena_cur = 0;
+    g_heap.arena_top = 0;
+    g_heap.arena_active = 0;
+    g_heap.arena_releases++;
+
+    heap_unlock();
+
+    return released;
+}
+
+/**
+ * @brief  Report usage, high-water mark and fragmentation of the heap.
+ * @param  stats  Filled with the current statistics.
+ **/
+void pal_heap_get_stats(pal_heap_stats_t *stats)
+{
+    heap_free_block_t *blk;
+    uint32_t order;
+
+    if (stats == NULL)
+        return;
+
+    heap_lock();
+
+    stats->heap_size = g_heap.end - g_heap.base;
+    stats->bytes_in_use = g_heap.pages_in_use << HEAP_PAGE_SHIFT;
+    stats->high_water = g_heap.pages_high_water << HEAP_PAGE_SHIFT;
+    stats->free_bytes = 0;
+    stats->largest_free = 0;
+
+    for (order = 0; order <= HEAP_MAX_ORDER; order++) {
+        for (blk = g_heap.free_list[order]; blk; blk = blk->next) {
+            stats->free_bytes += HEAP_PAGE_SIZE << order;
+            stats->largest_free = HEAP_PAGE_SIZE << order;
+        }
+    }
+
+    stats->fragmentation = stats->free_bytes ?
+        (uint32_t)(100 - (stats->largest_free * 100) / stats->free_bytes) : 0;
+    stats->live_allocs = g_heap.live_allocs;
+    stats->alloc_failures = g_heap.alloc_failures;
+    stats->arena_releases = g_heap.arena_releases;
+
+    heap_unlock();
+}
+
+/**
+ * @brief  Serialise the shared heap state from now on, called before the first
+ *         secondary PE is started.
+ *
+ * The lock is left off until then as the primary PE may use the heap before
+ * its MMU and caches are enabled, when exclusives and atomics are not
+ * guaranteed to work.
+ **/
+void pal_heap_set_multi_pe(void)
+{
+    g_heap_multi_pe = 1;
+}
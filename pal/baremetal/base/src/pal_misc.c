@@ -20,6 +20,7 @@
 #include "pal_pcie_enum.h"
 #include "pal_common_support.h"
 #include "pal_pl011_uart.h"
+#include "pal_heap.h"
 
 extern void* g_sbsa_log_file_handle;
 uint8_t   *gSharedMemory;
@@ -353,6 +354,69 @@ pal_mem_calloc(uint32_t num, uint32_t Size)
 }
 
 
+/**
+  @brief  Opens a heap arena, memory allocated until pal_mem_arena_release()
+          is owned by the arena and freed with it. An arena which is already
+          open is kept as it is.
+
+  @return None
+**/
+void
+pal_mem_arena_open(void)
+{
+  if (pal_heap_arena_open())
+      pal_print_msg(ACS_PRINT_WARN,
+                    "\n       Heap: arena already open, allocations stay in it");
+}
+
+/**
+  @brief  Starts allocations which are not owned by an open arena, for data
+          kept across tests. Ended by pal_mem_persist_end().
+
+  @return None
+**/
+void
+pal_mem_persist_begin(void)
+{
+  pal_heap_persist_begin();
+}
+
+/**
+  @brief  Ends allocations started by pal_mem_persist_begin().
+
+  @return None
+**/
+void
+pal_mem_persist_end(void)
+{
+  pal_heap_persist_end();
+}
+
+/**
+  @brief  Frees all memory allocated since pal_mem_arena_open() and closes
+          the arena.
+
+  @return Number of bytes returned to the heap
+**/
+uint64_t
+pal_mem_arena_release(void)
+{
+  pal_heap_stats_t stats;
+  uint64_t released;
+
+  released = pal_heap_arena_release();
+
+  pal_heap_get_stats(&stats);
+  pal_print_msg(ACS_PRINT_DEBUG,
+                "\n       Heap: released 0x%llx, in use 0x%llx, high-water 0x%llx",
+                released, stats.bytes_in_use, stats.high_water);
+  pal_print_msg(ACS_PRINT_DEBUG,
+                "\n       Heap: free 0x%llx, largest free block 0x%llx, fragmentation %d%%",
+                stats.free_bytes, stats.largest_free, stats.fragmentation);
+
+  return released;
+}
+
 /**
   @brief  Allocate memory which is to be used to share data across PEs
 
@@ -398,16 +462,34 @@ void *
 pal_memcpy(void *DestinationBuffer, const void *SourceBuffer, uint32_t Length)
 {
 
-    uint32_t i;
     const char *s = (char *)SourceBuffer;
     char *d = (char *) DestinationBuffer;
 
-    for(i = 0; i < Length; i++)
+    /* Copy 64-bit words once both buffers are aligned, only aligned accesses
+       are issued as the image is built with -mstrict-align */
+    if ((Length >= 8) && ((((uint64_t)d ^ (uint64_t)s) & 0x7) == 0))
+    {
+        while ((uint64_t)d & 0x7)
+        {
+            *d++ = *s++;
+            Length--;
+        }
+
+        while (Length >= 8)
+        {
+            *(uint64_t *)d = *(const uint64_t *)s;
+            d += 8;
+            s += 8;
+            Length -= 8;
+        }
+    }
+
+    while (Length--)
     {
-        d[i] = s[i];
+        *d++ = *s++;
     }
 
-    return d;
+    return DestinationBuffer;
 }
 
 uint32_t pal_strncmp(const char8_t *str1, const char8_t *str2, uint32_t len)
@@ -19,6 +19,7 @@
 #include "pal_pcie_enum.h"
 #include "platform_override_struct.h"
 #include "pal_sysreg.h"
+#include "pal_heap.h"
 
 extern const PE_INFO_TABLE platform_pe_cfg;
 extern const PE_SMBIOS_PROCESSOR_INFO_TABLE platform_smbios_cfg;
@@ -313,6 +314,9 @@ pal_pe_execute_payload(ARM_SMC_ARGS *ArmSmcArgs)
      return;
   }
 
+  /* The started PE may allocate from the heap alongside this one */
+  pal_heap_set_multi_pe();
+
   ArmSmcArgs->Arg2 = (uint64_t)ModuleEntryPoint;
   pal_pe_call_smc(ArmSmcArgs, gPsciConduit);
 }
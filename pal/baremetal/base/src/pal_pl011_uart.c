@@ -19,6 +19,7 @@
 
 static volatile uint64_t g_uart = PLATFORM_UART_BASE;
 static uint8_t is_uart_init_done;
+static uint32_t g_uart_tx_fifo_depth = UART_PL011_TX_FIFO_DEPTH_MIN;
 
 /**
  *   @brief    - This function initializes the UART
@@ -47,6 +48,17 @@ static void pal_driver_uart_pl011_init(void)
     /* Enable tx, rx, and uart overall */
     ((pal_uart_t *)g_uart)->uartcr = UART_PL011_UARTCR_EN_MASK
                             | UART_PL011_UARTCR_TX_EN_MASK;
+
+#ifdef UART_PL011_TX_FIFO_DEPTH
+    g_uart_tx_fifo_depth = UART_PL011_TX_FIFO_DEPTH;
+#else
+    /* PL011 revisions before r1p5 have a 16 byte FIFO */
+    if (((*(volatile uint32_t *)(g_uart + UART_PL011_UARTPERIPHID2_OFF) >>
+          UART_PL011_PERIPHID2_REV_SHIFT) & UART_PL011_PERIPHID2_REV_MASK) >= UART_PL011_REV_R1P5)
+        g_uart_tx_fifo_depth = UART_PL011_TX_FIFO_DEPTH_R1P5;
+    else
+        g_uart_tx_fifo_depth = UART_PL011_TX_FIFO_DEPTH_MIN;
+#endif
 }
 
 /**
@@ -92,7 +104,65 @@ void pal_driver_uart_pl011_putc(int c)
     ((pal_uart_t *)g_uart)->uartdr = pdata;
 }
 
+/**
+ *   @brief    - This function checks for a drained TX FIFO
+ *   @param    - none
+ *   @return   - status
+**/
+static int pal_driver_uart_pl011_is_tx_drained(void)
+{
+    if ((((pal_uart_t *)g_uart)->uartcr & UART_PL011_UARTCR_EN_MASK) &&
+        /* UART is enabled */
+        (((pal_uart_t *)g_uart)->uartcr & UART_PL011_UARTCR_TX_EN_MASK) &&
+        /* Transmit is enabled */
+        (((pal_uart_t *)g_uart)->uartfr & UART_PL011_UARTFR_TX_FIFO_EMPTY))
+    {
+        return 1;
+    } else
+    {
+        return 0;
+    }
+}
+
+/**
+ *   @brief    - This function writes a buffer to the UART. Once the TX FIFO
+ *               has drained, up to a FIFO depth of bytes is written without
+ *               polling the flag register for each byte.
+ *   @param    - buf : characters to be written
+ *   @param    - len : number of characters in buf
+ *   @return   - none
+**/
+void pal_driver_uart_pl011_write(const char *buf, uint32_t len)
+{
+    uint32_t burst;
+
+    if (is_uart_init_done == 0)
+    {
+        pal_driver_uart_pl011_init();
+        is_uart_init_done = 1;
+    }
+
+    while (len)
+    {
+        /* ensure TX FIFO to be empty */
+        while (!pal_driver_uart_pl011_is_tx_drained())
+          ;
+
+        burst = (len < g_uart_tx_fifo_depth) ? len : g_uart_tx_fifo_depth;
+        len -= burst;
+
+        /* write the data (upper 24 bits are reserved) */
+        while (burst--)
+            ((pal_uart_t *)g_uart)->uartdr = (uint8_t)*buf++;
+    }
+}
+
 void pal_uart_putc(char c)
 {
     pal_driver_uart_pl011_putc((uint8_t)c);
 }
+
+void pal_uart_write(const char *buf, uint32_t len)
+{
+    pal_driver_uart_pl011_write(buf, len);
+}
@@ -22,6 +22,7 @@
 #include "platform_override_struct.h"
 #include "platform_override_fvp.h"
 #include "pal_pl011_uart.h"
+#include "pal_heap.h"
 #include "acs_interface.h"
 
 /**
@@ -858,8 +859,6 @@ typedef struct {
     uint64_t size;
 } val_host_alloc_region_ts;
 
-static uint64_t heap_base;
-static uint64_t heap_top;
 static uint64_t heap_init_done = 0;
 
 /**
@@ -875,10 +874,12 @@ void
 pal_print(uint64_t data)
 {
     char *buf = (char *)(uintptr_t)data;
+    uint32_t len = 0;
 
-    while (*buf != '\0') {
-        pal_uart_putc(*buf++);
-    }
+    while (buf[len] != '\0')
+        len++;
+
+    pal_uart_write(buf, len);
 }
 
 /**
@@ -960,8 +961,8 @@ pal_mem_alloc_pages (uint32_t NumPages)
 void
 pal_mem_free_pages(void *PageBase, uint32_t NumPages)
 {
-  (void) PageBase;
   (void) NumPages;
+  mem_free(PageBase);
 }
 
 /**
@@ -1030,7 +1031,7 @@ pal_mem_free_at_address(uint64_t mem_base,
 }
 
 /* Functions implemented below are used to allocate memory from heap. Baremetal implementation
-   of memory allocation.
+   of memory allocation, backed by the slab, buddy and arena allocator of pal_heap.c
 */
 
 static int is_power_of_2(uint32_t n)
@@ -1038,30 +1039,6 @@ static int is_power_of_2(uint32_t n)
     return n && !(n & (n - 1));
 }
 
-/**
- * @brief Allocates contiguous memory of requested size(no_of_bytes) and alignment.
- * @param alignment - alignment for the address. It must be in power of 2.
- * @param Size - Size of the region. It must not be zero.
- * @return - Returns allocated memory base address if allocation is successful.
- *           Otherwise returns NULL.
- **/
-void *heap_alloc(size_t alignment, size_t size)
-{
-    uint64_t addr;
-
-    addr = ADDR_ALIGN(heap_base, alignment);
-    size += addr - heap_base;
-
-    if ((heap_top - heap_base) < size)
-    {
-       return NULL;
-    }
-
-    heap_base += size;
-
-    return (void *)addr;
-}
-
 /**
  * @brief  Initialisation of allocation data structure
  * @param  void
@@ -1069,9 +1046,8 @@ void *heap_alloc(size_t alignment, size_t size)
  **/
 void mem_alloc_init(void)
 {
-    heap_base = PLATFORM_HEAP_REGION_BASE;
-    heap_top = PLATFORM_HEAP_REGION_BASE + PLATFORM_HEAP_REGION_SIZE;
-    heap_init_done = 1;
+    pal_heap_init(PLATFORM_HEAP_REGION_BASE, PLATFORM_HEAP_REGION_SIZE);
+    heap_init_done = HEAP_INITIALISED;
 }
 
 /**
@@ -1083,9 +1059,7 @@ void mem_alloc_init(void)
  **/
 void *mem_alloc(size_t alignment, size_t size)
 {
-  void *addr = NULL;
-
-  if(heap_init_done != 1)
+  if (heap_init_done != HEAP_INITIALISED)
     mem_alloc_init();
 
   if (size <= 0)
@@ -1098,25 +1072,19 @@ void *mem_alloc(size_t alignment, size_t size)
     return NULL;
   }
 
-  size += alignment - 1;
-  addr = heap_alloc(alignment, size);
-
-  return addr;
+  return pal_heap_alloc(alignment, size);
 }
 
 /**
- * TODO: Free the memory for given memory address
- * Currently acs code is initialisazing from base for every test,
- * the regions data structure is internal and below code only setting to zero
- * not actually freeing memory.
- * If require can revisit in future.
+ * @brief Free the memory for given memory address
+ * @param ptr - Address returned by mem_alloc().
  **/
 void mem_free(void *ptr)
 {
   if (!ptr)
     return;
 
-  return;
+  pal_heap_free(ptr);
 }
 
 /**
@@ -1151,9 +1119,9 @@ pal_mem_free_cacheable(uint32_t Bdf, uint32_t Size, void *Va, void *Pa)
 
   (void) Bdf;
   (void) Size;
-  (void) Va;
   (void) Pa;
 
+  mem_free(Va);
 }
 
 /** DMA PAL PAI's **/
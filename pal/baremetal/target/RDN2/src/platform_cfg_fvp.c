@@ -84,6 +84,24 @@ acs_get_platform_run_request_defaults(void)
  *
  * el1skiptrap_mask is a bitmask composed from EL1SKIPTRAP_* flags when a
  * platform needs specific EL1 register accesses skipped.
+ *
+ * pcie_cfg_cache enables the PCIe config space shadow for read-only
+ * structural registers.
+ *
+ * pcie_parallel_enum probes the PCIe ECAM buses on all PEs while the
+ * BDF table is created.
+ *
+ * parallel_rules runs the PE-local rules on idle secondary PEs before
+ * the rule list is walked.
+ *
+ * heap_test_arena frees the memory a test allocated once it reports its
+ * result.
+ *
+ * pe_fanout wakes the secondary PEs of a multi-PE test in a tree instead
+ * of one after the other from the primary PE.
+ *
+ * pe_worker_pool parks secondary PEs after their payload and posts later
+ * payloads to them instead of powering them off and on again.
  */
 static const acs_execution_policy_t g_platform_execution_policy = {
     .timeout_pass = PLATFORM_OVERRIDE_TIMEOUT,
@@ -92,6 +110,12 @@ static const acs_execution_policy_t g_platform_execution_policy = {
     .crypto_support = TRUE,
     .sys_last_lvl_cache = PLATFORM_OVERRRIDE_SLC,
     .el1skiptrap_mask = 0,
+    .pcie_cfg_cache = PLATFORM_OVERRIDE_PCIE_CFG_CACHE,
+    .pcie_parallel_enum = PLATFORM_OVERRIDE_PCIE_PARALLEL_ENUM,
+    .parallel_rules = PLATFORM_OVERRIDE_PARALLEL_RULES,
+    .heap_test_arena = PLATFORM_OVERRIDE_HEAP_TEST_ARENA,
+    .pe_fanout = PLATFORM_OVERRIDE_PE_FANOUT,
+    .pe_worker_pool = PLATFORM_OVERRIDE_PE_WORKER_POOL,
 };
 
 const acs_execution_policy_t *
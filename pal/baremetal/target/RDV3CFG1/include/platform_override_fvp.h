@@ -264,6 +264,12 @@
 
 #define PLATFORM_PCIE_NUM_ENTRIES        21   /* Number of devices in PCIe hierarchy             */
 #define PLATFORM_PCIE_P2P_NOT_SUPPORTED  1    /* PCIe hierarchy forbids peer-to-peer transfers   */
+#define PLATFORM_OVERRIDE_PCIE_CFG_CACHE 0    /* Shadow read-only PCIe config registers          */
+#define PLATFORM_OVERRIDE_PCIE_PARALLEL_ENUM 0 /* Probe PCIe ECAM buses on all PEs               */
+#define PLATFORM_OVERRIDE_PARALLEL_RULES 0 /* Run PE-local rules on secondary PEs */
+#define PLATFORM_OVERRIDE_HEAP_TEST_ARENA 0 /* Free test allocations at test end */
+#define PLATFORM_OVERRIDE_PE_FANOUT 0 /* Wake secondary PEs in a tree */
+#define PLATFORM_OVERRIDE_PE_WORKER_POOL 0 /* Park secondary PEs between payloads */
 
 #define PLATFORM_PCIE_DEV0_CLASSCODE     0x6040000   /* DEV0: Device class code                  */
 #define PLATFORM_PCIE_DEV0_VENDOR_ID     0x13B5      /* DEV0: Device vendor ID                   */
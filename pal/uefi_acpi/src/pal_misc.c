@@ -780,6 +780,21 @@ pal_mem_set_wb_executable (
   return 0;
 }
 
+void pal_uart_write(const char *buf, uint32_t len)
+{
+    UINTN n = len;
+
+    AsciiPrint("%.*a", n, buf);
+
+    if (g_acs_log_file_handle) {
+        EFI_STATUS Status = ShellWriteFile(g_acs_log_file_handle, &n, (VOID *)buf);
+        if (EFI_ERROR(Status)) {
+            pal_print_msg(ACS_PRINT_ERR,
+                          " Error in writing to log file\n");
+        }
+    }
+}
+
 void pal_uart_putc(char c)
 {
     CHAR8 ch = (CHAR8)c;
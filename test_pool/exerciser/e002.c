@@ -226,8 +226,9 @@ test_fail:
       status = ACS_STATUS_FAIL;
 
 test_clean:
-      val_pgt_destroy(*pgt_desc);
+      /* Invalidate the STE before its page table is released */
       val_smmu_unmap(master);
+      val_pgt_destroy(*pgt_desc);
 
   return status;
 }
@@ -350,7 +350,11 @@ test_clean:
   /* Return the pages to the heap manager */
   val_memory_free_pages(dram_buf_in_virt, TEST_DATA_NUM_PAGES);
 
-  /* Remove all address mappings for each exerciser */
+  /* Remove all address mappings for each exerciser, with one STE invalidation
+     per SMMU */
+  for (instance = 0; instance < num_smmus; ++instance)
+     val_smmu_batch_begin(instance);
+
   for (instance = 0; instance < num_exercisers; ++instance)
   {
     e_bdf = val_exerciser_get_bdf(instance);
@@ -364,11 +368,6 @@ test_clean:
 
     val_smmu_unmap(master);
 
-    if (pgt_base_array[instance] != 0) {
-      pgt_desc.pgt_base = pgt_base_array[instance];
-      val_pgt_destroy(pgt_desc);
-    }
-
     if (val_pcie_find_capability(e_bdf, PCIE_ECAP, ECID_ATS, &cap_base) == PCIE_SUCCESS)
     {
         val_pcie_read_cfg(e_bdf, cap_base + ATS_CTRL, &reg_value);
@@ -378,6 +377,18 @@ test_clean:
 
   }
 
+  for (instance = 0; instance < num_smmus; ++instance)
+     val_smmu_batch_end(instance);
+
+  /* The STEs are invalidated, release the page tables */
+  for (instance = 0; instance < num_exercisers; ++instance)
+  {
+    if (pgt_base_array[instance] != 0) {
+      pgt_desc.pgt_base = pgt_base_array[instance];
+      val_pgt_destroy(pgt_desc);
+    }
+  }
+
   /* Disable all SMMUs */
   for (instance = 0; instance < num_smmus; ++instance)
      val_smmu_disable(instance);
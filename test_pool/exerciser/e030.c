@@ -89,6 +89,11 @@ payload(void)
   for (instance = 0; instance < num_smmus; ++instance)
      val_smmu_enable(instance);
 
+  /* No DMA is issued, so the STE invalidation of every map and unmap is
+     deferred to a single CFGI per SMMU once the mappings are removed */
+  for (instance = 0; instance < num_smmus; ++instance)
+     val_smmu_batch_begin(instance);
+
   for (instance = 0; instance < num_exercisers; ++instance) {
 
     /* if init fail moves to next exerciser */
@@ -200,6 +205,14 @@ test_clean:
                                    &its_id))
         continue;
     val_smmu_unmap(master);
+  }
+
+  for (instance = 0; instance < num_smmus; ++instance)
+     val_smmu_batch_end(instance);
+
+  /* The STEs are invalidated, release the page tables */
+  for (instance = 0; instance < num_exercisers; ++instance)
+  {
     if (pgt_base_array[instance] != 0) {
       pgt_desc.pgt_base = pgt_base_array[instance];
       val_pgt_destroy(pgt_desc);
@@ -77,14 +77,15 @@ run_cxl_path_ats_dma(uint32_t e_bdf)
   uint64_t dram_buf_iova;
   uint64_t dram_buf_out_iova;
   pgt_descriptor_t pgt_desc;
-  memory_region_descriptor_t mem_desc;
+  memory_region_descriptor_t mem_desc_array[2], *mem_desc;
   smmu_master_attributes_t master;
   uint8_t ats_enabled = 0;
   uint8_t smmu_mapped = 0;
   uint8_t smmu_enabled = 0;
 
   val_memory_set(&master, sizeof(master), 0);
-  val_memory_set(&mem_desc, sizeof(mem_desc), 0);
+  val_memory_set(mem_desc_array, sizeof(mem_desc_array), 0);
+  mem_desc = &mem_desc_array[0];
   val_memory_set(&pgt_desc, sizeof(pgt_desc), 0);
 
   rc_index = val_iovirt_get_rc_index(PCIE_EXTRACT_BDF_SEG(e_bdf));
@@ -125,7 +126,7 @@ run_cxl_path_ats_dma(uint32_t e_bdf)
   pgt_desc.mair = val_pe_reg_read(MAIR_ELx);
   pgt_desc.pgt_base = (ttbr & AARCH64_TTBR_ADDR_MASK);
 
-  if (val_pgt_get_attributes(pgt_desc, (uint64_t)dram_buf_virt, &mem_desc.attributes))
+  if (val_pgt_get_attributes(pgt_desc, (uint64_t)dram_buf_virt, &mem_desc->attributes))
     goto test_fail;
 
   master.smmu_index = val_iovirt_get_rc_smmu_index(PCIE_EXTRACT_BDF_SEG(e_bdf),
@@ -149,15 +150,15 @@ run_cxl_path_ats_dma(uint32_t e_bdf)
 
   smmu_enabled = 1;
 
-  mem_desc.virtual_address = (uint64_t)dram_buf_virt + (2 * page_size);
-  mem_desc.physical_address = dram_buf_phys;
-  mem_desc.length = page_size;
-  mem_desc.attributes |= PGT_STAGE1_AP_RW;
+  mem_desc->virtual_address = (uint64_t)dram_buf_virt + (2 * page_size);
+  mem_desc->physical_address = dram_buf_phys;
+  mem_desc->length = page_size;
+  mem_desc->attributes |= PGT_STAGE1_AP_RW;
 
   /* set pgt_desc.pgt_base to NULL to create new translation table, val_pgt_create
      will update pgt_desc.pgt_base to point to created translation table */
   pgt_desc.pgt_base = 0;
-  if (val_pgt_create(&mem_desc, &pgt_desc)) {
+  if (val_pgt_create(mem_desc, &pgt_desc)) {
     val_print(ERROR, "\n       Unable to create page table with given attributes");
     goto test_fail;
   }
@@ -171,7 +172,7 @@ run_cxl_path_ats_dma(uint32_t e_bdf)
 
   clear_dram_buf(dram_buf_virt, page_size);
 
-  dram_buf_iova = mem_desc.virtual_address;
+  dram_buf_iova = mem_desc->virtual_address;
   dram_buf_out_iova = dram_buf_iova + dma_len;
 
   val_exerciser_set_param(DMA_ATTRIBUTES, dram_buf_iova, dma_len, instance);
@@ -456,7 +456,7 @@ payload_primary(void)
                 }
 
                 /* Free the copy buffers to the heap manager */
-                val_mem_free_shared_memcpybuf(NUM_PE_CONT);
+                val_mem_free_shared_memcpybuf(num_pe_cont);
             }
         }
     }
@@ -21,6 +21,67 @@
 #include "gic_v2.h"
 #include "gic.h"
 
+static uint32_t
+gic_v3_AcknowledgeInterrupt(void)
+{
+  return (uint32_t) v3_AcknowledgeInterrupt();
+}
+
+static const GIC_OPS gic_v2_ops = {
+  v2_Init,
+  v2_EnableInterruptSource,
+  v2_DisableInterruptSource,
+  v2_AcknowledgeInterrupt,
+  v2_EndofInterrupt
+};
+
+/* GICv4 only adds virtual LPI support, physical interrupts are handled as on GICv3 */
+static const GIC_OPS gic_v3_ops = {
+  v3_Init,
+  v3_EnableInterruptSource,
+  v3_DisableInterruptSource,
+  gic_v3_AcknowledgeInterrupt,
+  v3_EndofInterrupt
+};
+
+static const GIC_OPS *g_gic_ops;
+static uint32_t      g_gic_version;
+
+/**
+  @brief  Select the GIC ops for a GIC version, called once the GIC info
+          table is created so that the interrupt paths do not query the
+          version on every call
+  @param  gic_version GIC architecture version
+  @return none
+**/
+void
+val_gic_select_ops(uint32_t gic_version)
+{
+  g_gic_version = gic_version;
+  if ((gic_version == 3) || (gic_version == 4))
+      g_gic_ops = &gic_v3_ops;
+  else
+      g_gic_ops = &gic_v2_ops;
+}
+
+static const GIC_OPS *
+gic_get_ops(void)
+{
+  if (g_gic_ops == NULL)
+      val_gic_select_ops(val_gic_get_info(GIC_INFO_VERSION));
+
+  return g_gic_ops;
+}
+
+static uint32_t
+gic_get_version(void)
+{
+  if (g_gic_ops == NULL)
+      val_gic_select_ops(val_gic_get_info(GIC_INFO_VERSION));
+
+  return g_gic_version;
+}
+
 /**
   @brief  Initializes the GIC
   @param  none
@@ -29,13 +90,7 @@
 void
 val_gic_init(void)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if ((gic_version == 3) || (gic_version == 4))
-      v3_Init();
-  else
-      v2_Init();
+  gic_get_ops()->init();
 }
 
 /**
@@ -46,13 +101,7 @@ val_gic_init(void)
 void
 val_gic_enableInterruptSource(uint32_t int_id)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if ((gic_version == 3) || (gic_version == 4))
-      v3_EnableInterruptSource(int_id);
-  else
-      v2_EnableInterruptSource(int_id);
+  gic_get_ops()->enable_int(int_id);
 }
 
 /**
@@ -63,13 +112,7 @@ val_gic_enableInterruptSource(uint32_t int_id)
 void
 val_gic_disableInterruptSource(uint32_t int_id)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if ((gic_version == 3) || (gic_version == 4))
-      v3_DisableInterruptSource(int_id);
-  else
-      v2_DisableInterruptSource(int_id);
+  gic_get_ops()->disable_int(int_id);
 }
 
 /**
@@ -80,13 +123,7 @@ val_gic_disableInterruptSource(uint32_t int_id)
 uint32_t
 val_gic_acknowledgeInterrupt(void)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if ((gic_version == 3) || (gic_version == 4))
-      return (uint32_t) v3_AcknowledgeInterrupt();
-  else
-      return v2_AcknowledgeInterrupt();
+  return gic_get_ops()->ack_int();
 }
 
 /**
@@ -97,13 +134,7 @@ val_gic_acknowledgeInterrupt(void)
 void
 val_gic_endofInterrupt(uint32_t int_id)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if ((gic_version == 3) || (gic_version == 4))
-      v3_EndofInterrupt(int_id);
-  else
-      v2_EndofInterrupt(int_id);
+  gic_get_ops()->end_of_int(int_id);
 }
 
 /**
@@ -114,10 +145,7 @@ val_gic_endofInterrupt(uint32_t int_id)
 uint32_t
 val_gic_espi_support(void)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if (gic_version >= 3)
+  if (gic_get_version() >= 3)
       return (v3_read_gicdTyper() >> GICD_TYPER_ESPI_SHIFT) & GICD_TYPER_ESPI_MASK;
   else
       return 0;
@@ -131,12 +159,10 @@ val_gic_espi_support(void)
 uint32_t
 val_gic_max_espi_val(void)
 {
-  uint32_t gic_version;
   uint32_t espi_range;
   uint32_t max_espi_val = 0;
 
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if (gic_version >= 3) {
+  if (gic_get_version() >= 3) {
       espi_range = (v3_read_gicdTyper() >> GICD_TYPER_ESPI_RANGE_SHIFT) &
                                                                     GICD_TYPER_ESPI_RANGE_MASK;
       max_espi_val = (32 * (espi_range + 1) + 4095);
@@ -184,10 +210,7 @@ void val_gic_clear_espi_interrupt(uint32_t int_id)
 uint32_t
 val_gic_eppi_support(void)
 {
-  uint32_t gic_version;
-
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if (gic_version >= 3) {
+  if (gic_get_version() >= 3) {
       if ((v3_read_gicr_typer() >> GICD_TYPER_EPPI_NUM_SHIFT) & GICD_TYPER_EPPI_NUM_MASK)
         return 1;
       else
@@ -205,11 +228,9 @@ val_gic_eppi_support(void)
 uint32_t
 val_gic_max_eppi_val(void)
 {
-  uint32_t gic_version;
   uint32_t ppi_range;
 
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-  if (gic_version >= 3) {
+  if (gic_get_version() >= 3) {
       ppi_range = ((v3_read_gicr_typer() >> GICD_TYPER_EPPI_NUM_SHIFT) & GICD_TYPER_EPPI_NUM_MASK);
       if (ppi_range == 1)
         return 1087;
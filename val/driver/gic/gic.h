@@ -54,6 +54,16 @@
 #define PE_AFF3         (0xFFULL << 32)
 #define MAX_SGI_PPI     32
 
+/* Version specific interrupt handling, selected once by val_gic_select_ops() */
+typedef struct {
+  void     (*init)(void);
+  void     (*enable_int)(uint32_t int_id);
+  void     (*disable_int)(uint32_t int_id);
+  uint32_t (*ack_int)(void);
+  void     (*end_of_int)(uint32_t int_id);
+} GIC_OPS;
+
+void val_gic_select_ops(uint32_t gic_version);
 
 void val_gic_init(void);
 void val_gic_disableInterruptSource(uint32_t int_id);
@@ -21,7 +21,7 @@
 #include "val_sysreg_pe.h"
 
 extern GIC_ITS_INFO    *g_gic_its_info;
-static uint32_t        *g_cwriter_ptr;
+static ITS_CMDQ_STATE  *g_its_cmdq;
 static uint32_t        g_its_setup_done;
 
 uint32_t GET_NUM_BITS(uint64_t value)
@@ -305,145 +305,238 @@ static void EnableITS(uint64_t GicItsBase)
   val_mmio_write(GicItsBase + ARM_GITS_CTLR, (value | ARM_GITS_CTLR_ENABLE));
 }
 
-static void
+/* Number of free command slots, one slot is kept empty so that a full queue
+   can be told apart from an empty one */
+static uint32_t ItsCmdQSpace(ITS_CMDQ_STATE *state)
+{
+  return ((state->creadr + ITS_CMDQ_SIZE - state->cwriter - ITS_CMD_SIZE) % ITS_CMDQ_SIZE)
+         / ITS_CMD_SIZE;
+}
+
+static void ItsCmdQPublish(uint32_t its_index)
+{
+  /* Make the commands and any LPI configuration writes visible to the ITS */
+  dsbsy();
+  val_mmio_write64(g_gic_its_info->GicIts[its_index].Base + ARM_GITS_CWRITER,
+                   g_its_cmdq[its_index].cwriter);
+}
+
+/* Refresh the cached GITS_CREADR, asking the ITS to retry a stalled command */
+static void ItsCmdQReadCreadr(uint32_t its_index)
+{
+  uint64_t    creadr_value;
+  uint64_t    ItsBase;
+
+  ItsBase = g_gic_its_info->GicIts[its_index].Base;
+  creadr_value = val_mmio_read64(ItsBase + ARM_GITS_CREADR);
+
+  if (creadr_value & ARM_GITS_CREADR_STALL)
+    val_mmio_write64((ItsBase + ARM_GITS_CWRITER),
+                     (g_its_cmdq[its_index].cwriter | ARM_GITS_CWRITER_RETRY));
+
+  g_its_cmdq[its_index].creadr = creadr_value & ARM_GITS_CREADR_OFFSET_MASK;
+}
+
+static uint32_t ItsCmdQWaitSpace(uint32_t its_index)
+{
+  uint32_t    count = 0;
+
+  ItsCmdQPublish(its_index);
+
+  do {
+    ItsCmdQReadCreadr(its_index);
+    count++;
+    if (count > WAIT_ITS_COMMAND_DONE) {
+      val_print(ERROR,
+                "\n       ITS : Command Queue full, READR not moving, Test may not pass");
+      return 1;
+    }
+  } while (ItsCmdQSpace(&g_its_cmdq[its_index]) == 0);
+
+  return 0;
+}
+
+/* Write a command at the shadow CWRITER, wrapping at the end of the queue.
+   Returns 1 if the queue stayed full and the command was not written. */
+static uint32_t ItsCmdQPush(uint32_t its_index, uint64_t *cmd)
+{
+  ITS_CMDQ_STATE       *state = &g_its_cmdq[its_index];
+  volatile uint64_t    *slot;
+  uint32_t             i;
+
+  if ((ItsCmdQSpace(state) == 0) && ItsCmdQWaitSpace(its_index))
+    return 1;
+
+  slot = (volatile uint64_t *)(g_gic_its_info->GicIts[its_index].CommandQBase +
+                               state->cwriter);
+  for (i = 0; i < ITS_NEXT_CMD_PTR; i++)
+    slot[i] = cmd[i];
+
+  state->cwriter = (state->cwriter + ITS_CMD_SIZE) % ITS_CMDQ_SIZE;
+  return 0;
+}
+
+/* Remember device_id as mapped, returns 1 if it already was */
+static uint32_t ItsDeviceMapped(ITS_CMDQ_STATE *state, uint32_t device_id)
+{
+  uint32_t    i;
+
+  for (i = 0; i < state->num_mapped_dev; i++) {
+    if (state->mapped_dev[i] == device_id)
+      return 1;
+  }
+
+  if (state->num_mapped_dev < ITS_MAPPED_DEV_MAX)
+    state->mapped_dev[state->num_mapped_dev++] = device_id;
+
+  return 0;
+}
+
+static void ItsDeviceUnmapped(ITS_CMDQ_STATE *state, uint32_t device_id)
+{
+  uint32_t    i;
+
+  for (i = 0; i < state->num_mapped_dev; i++) {
+    if (state->mapped_dev[i] == device_id) {
+      state->mapped_dev[i] = state->mapped_dev[--state->num_mapped_dev];
+      return;
+    }
+  }
+}
+
+static uint32_t
 WriteCmdQMAPD(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
    uint64_t     device_id,
    uint64_t     ITT_BASE,
    uint32_t     Size,
    uint64_t     Valid
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)((device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_MAPD));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1), (uint64_t)(Size));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2),
-                     (uint64_t)((Valid << ITS_CMD_SHIFT_VALID) | (ITT_BASE & ITT_PAR_MASK)));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = (device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_MAPD;
+    cmd[1] = Size;
+    cmd[2] = (Valid << ITS_CMD_SHIFT_VALID) | (ITT_BASE & ITT_PAR_MASK);
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
-static void
+static uint32_t
 WriteCmdQMAPC(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
    uint32_t     Clctn_ID,
-   uint32_t     RDBase,
+   uint64_t     RDBase,
    uint64_t     Valid
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)(ARM_ITS_CMD_MAPC));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1), (uint64_t)(0x0));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2),
-                     (uint64_t)((Valid << ITS_CMD_SHIFT_VALID) | RDBase | Clctn_ID));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = ARM_ITS_CMD_MAPC;
+    cmd[1] = 0;
+    cmd[2] = (Valid << ITS_CMD_SHIFT_VALID) | RDBase | Clctn_ID;
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
-static void
+static uint32_t
 WriteCmdQMAPTI(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
    uint64_t     device_id,
    uint32_t     int_id,
    uint32_t     Clctn_ID
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)((device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_MAPTI));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1),
-                     ((uint64_t)(int_id-ARM_LPI_MINID) | ((uint64_t)int_id << 32)));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(Clctn_ID));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = (device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_MAPTI;
+    cmd[1] = (uint64_t)(int_id-ARM_LPI_MINID) | ((uint64_t)int_id << 32);
+    cmd[2] = Clctn_ID;
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
-static void
-WriteCmdQINV(
+static uint32_t
+WriteCmdQINVALL(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
-   uint64_t     device_id,
-   uint32_t     int_id
+   uint32_t     Clctn_ID
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)((device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_INV));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1),
-                     (uint64_t)(int_id-ARM_LPI_MINID));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(0x0));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = ARM_ITS_CMD_INVALL;
+    cmd[1] = 0;
+    cmd[2] = Clctn_ID;
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
-static void
+static uint32_t
 WriteCmdQDISCARD(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
    uint64_t     device_id,
    uint32_t     int_id
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)((device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_DISCARD));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1),
-                     (uint64_t)(int_id-ARM_LPI_MINID));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(0x0));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = (device_id << ITS_CMD_SHIFT_DEVID) | ARM_ITS_CMD_DISCARD;
+    cmd[1] = int_id-ARM_LPI_MINID;
+    cmd[2] = 0;
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
 
-static void
+static uint32_t
 WriteCmdQSYNC(
    uint32_t     its_index,
-   uint64_t     *CMDQ_BASE,
-   uint32_t     RDBase
+   uint64_t     RDBase
   )
 {
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index]),
-                     (uint64_t)(ARM_ITS_CMD_SYNC));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 1), (uint64_t)(0x0));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 2), (uint64_t)(RDBase));
-    val_mmio_write64((uint64_t)(CMDQ_BASE + g_cwriter_ptr[its_index] + 3), (uint64_t)(0x0));
-    g_cwriter_ptr[its_index] = g_cwriter_ptr[its_index] + ITS_NEXT_CMD_PTR;
+    uint64_t cmd[ITS_NEXT_CMD_PTR];
+
+    cmd[0] = ARM_ITS_CMD_SYNC;
+    cmd[1] = 0;
+    cmd[2] = RDBase;
+    cmd[3] = 0;
+    return ItsCmdQPush(its_index, cmd);
 }
 
-static void PollTillCommandQueueDone(uint32_t its_index)
+/* Publish the queued commands and wait for the ITS to consume all of them.
+   Returns 1 if CREADR did not reach CWRITER. */
+static uint32_t PollTillCommandQueueDone(uint32_t its_index)
 {
-  uint32_t    count;
-  uint64_t    creadr_value;
-  uint64_t    stall_value;
-  uint64_t    cwriter_value;
-  uint64_t    ItsBase;
+  uint32_t          count;
+  ITS_CMDQ_STATE    *state = &g_its_cmdq[its_index];
 
-  count = 0;
-  ItsBase = g_gic_its_info->GicIts[its_index].Base;
-  cwriter_value = val_mmio_read64(ItsBase + ARM_GITS_CWRITER);
-  creadr_value = val_mmio_read64(ItsBase + ARM_GITS_CREADR);
+  ItsCmdQPublish(its_index);
 
-  while (creadr_value != cwriter_value) {
-    /* Check Stall Value */
-    stall_value = creadr_value & ARM_GITS_CREADR_STALL;
-
-    if (stall_value) {
-      /* Retry */
-      val_mmio_write64((ItsBase + ARM_GITS_CWRITER),
-                  (cwriter_value | ARM_GITS_CWRITER_RETRY)
-                 );
-    }
+  count = 0;
+  ItsCmdQReadCreadr(its_index);
 
+  while (state->creadr != state->cwriter) {
     count++;
     if (count > WAIT_ITS_COMMAND_DONE) {
       val_print(ERROR,
                 "\n       ITS : Command Queue READR not moving, Test may not pass");
-      break;
+      return 1;
     }
 
-    creadr_value = val_mmio_read64(ItsBase + ARM_GITS_CREADR);
+    ItsCmdQReadCreadr(its_index);
   }
 
+  dsbsy();
+  return 0;
+}
+
+/* The commands of a batch did not all reach the ITS, so the cached
+   collection and device mappings are no longer known */
+static uint32_t ItsCmdQFail(ITS_CMDQ_STATE *state)
+{
+  state->clctn_mapped = 0;
+  state->num_mapped_dev = 0;
+  return ACS_STATUS_ERR;
 }
 
 static uint64_t GetRDBaseFormat(uint32_t its_index)
@@ -471,95 +564,134 @@ static uint64_t GetRDBaseFormat(uint32_t its_index)
 }
 
 
-void val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id)
+uint32_t val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id)
 {
-  uint64_t    value;
-  uint64_t    RDBase;
-  uint64_t    ItsBase;
-  uint64_t    ItsCommandBase;
+  ITS_CMDQ_STATE    *state;
 
   if (!g_its_setup_done)
-    return;
+    return ACS_STATUS_ERR;
 
-  ItsBase        = g_gic_its_info->GicIts[its_index].Base;
-  ItsCommandBase = g_gic_its_info->GicIts[its_index].CommandQBase;
+  state = &g_its_cmdq[its_index];
 
   /* Clear Config table for LPI=int_id */
   ClearConfigTable(int_id);
 
   /* Get RDBase Depending on GITS_TYPER.PTA */
-  RDBase = GetRDBaseFormat(its_index);
+  if (!state->clctn_mapped)
+    state->rd_base = GetRDBaseFormat(its_index);
 
   /* Discard Mappings */
-  WriteCmdQDISCARD(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id);
+  if (WriteCmdQDISCARD(its_index, device_id, int_id))
+    return ItsCmdQFail(state);
   /* Un Map Device using MAPD */
-  WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), device_id,
-                g_gic_its_info->GicIts[its_index].ITTBase,
-                0, 0 /*InValid*/);
+  if (WriteCmdQMAPD(its_index, device_id, g_gic_its_info->GicIts[its_index].ITTBase,
+                    0, 0 /*InValid*/))
+    return ItsCmdQFail(state);
+  ItsDeviceUnmapped(state, device_id);
   /* ITS SYNC Command */
-  WriteCmdQSYNC(its_index, (uint64_t *)(ItsCommandBase), RDBase);
-
-  dsbsy();
-  /* Update the CWRITER Register so that all the commands from Command queue gets executed.*/
-  value = ((g_cwriter_ptr[its_index] * NUM_BYTES_IN_DW));
-  val_mmio_write64((ItsBase + ARM_GITS_CWRITER), value);
+  if (WriteCmdQSYNC(its_index, state->rd_base))
+    return ItsCmdQFail(state);
 
-  /* Check CREADR value which ensures Command Queue is processed */
-  PollTillCommandQueueDone(its_index);
-  dsbsy();
+  /* Update CWRITER and check CREADR which ensures Command Queue is processed */
+  if (PollTillCommandQueueDone(its_index))
+    return ItsCmdQFail(state);
 
+  return 0;
 }
 
-void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
-                            uint32_t int_id, uint32_t Priority)
+/**
+  @brief   Map a set of LPIs of one device with one pass over the command
+           queue. MAPD is sent once per device and MAPC once per ITS, followed
+           by a MAPTI per LPI, a single INVALL and SYNC, and a single CWRITER
+           update. Every device is mapped with the single ITT of the ITS, so
+           the LPIs of only one device may be mapped at a time.
+  @param   its_index  Index of the ITS in the ITS info table
+  @param   maps       DeviceID, LPI pairs to map, all with the same DeviceID
+  @param   num        Number of entries in maps
+  @param   Priority   Priority of the LPIs
+  @return  0 on success, ACS_STATUS_ERR if the ITS did not accept the commands
+**/
+uint32_t val_its_create_lpi_maps(uint32_t its_index, ITS_LPI_MAP *maps, uint32_t num,
+                                 uint32_t Priority)
 {
-  uint64_t    value;
-  uint64_t    RDBase;
-  uint64_t    ItsBase;
-  uint64_t    ItsCommandBase;
+  uint32_t          i;
+  uint64_t          ItsBase;
+  ITS_CMDQ_STATE    *state;
 
   if (!g_its_setup_done)
-    return;
+    return ACS_STATUS_ERR;
 
-  ItsBase        = g_gic_its_info->GicIts[its_index].Base;
-  ItsCommandBase = g_gic_its_info->GicIts[its_index].CommandQBase;
+  if (num == 0)
+    return 0;
+
+  for (i = 1; i < num; i++) {
+    if (maps[i].device_id != maps[0].device_id) {
+      val_print(ERROR, "\n       ITS : LPI batch spans devices, ITT would be shared");
+      return ACS_STATUS_ERR;
+    }
+  }
+
+  ItsBase = g_gic_its_info->GicIts[its_index].Base;
+  state   = &g_its_cmdq[its_index];
 
   /* Set Config table with enable the LPI = int_id, Priority. */
-  SetConfigTable(int_id, Priority);
+  for (i = 0; i < num; i++)
+    SetConfigTable(maps[i].int_id, Priority);
 
   /* Enable Redistributor */
-  EnableLPIsRD(g_gic_its_info->GicRdBase);
+  if (!(val_mmio_read(g_gic_its_info->GicRdBase + ARM_GICR_CTLR) & ARM_GICR_CTLR_ENABLE_LPIS))
+    EnableLPIsRD(g_gic_its_info->GicRdBase);
+
+  /* Enable ITS. If it was disabled since the last map (e.g. by a DRTM launch)
+     the cached collection and device mappings are not trusted either. */
+  if (!(val_mmio_read(ItsBase + ARM_GITS_CTLR) & ARM_GITS_CTLR_ENABLE)) {
+    EnableITS(ItsBase);
+    state->clctn_mapped = 0;
+    state->num_mapped_dev = 0;
+  }
 
-  /* Enable ITS */
-  EnableITS(ItsBase);
+  /* Map Collection using MAPC, RDBase Depending on GITS_TYPER.PTA */
+  if (!state->clctn_mapped) {
+    state->rd_base = GetRDBaseFormat(its_index);
+    if (WriteCmdQMAPC(its_index, ITS_CLCN_ID, state->rd_base, 0x1 /*Valid*/))
+      return ItsCmdQFail(state);
+    state->clctn_mapped = 1;
+  }
 
-  /* Get RDBase Depending on GITS_TYPER.PTA */
-  RDBase = GetRDBaseFormat(its_index);
-
-  /* Map Device using MAPD */
-  WriteCmdQMAPD(its_index, (uint64_t *)(ItsCommandBase), device_id,
-                g_gic_its_info->GicIts[its_index].ITTBase,
-                g_gic_its_info->GicIts[its_index].IDBits, 0x1 /*Valid*/);
-  /* Map Collection using MAPC */
-  WriteCmdQMAPC(its_index, (uint64_t *)(ItsCommandBase),
-                0x1 /*Clctn_ID*/, RDBase, 0x1 /*Valid*/);
-  /* Map Interrupt using MAPI */
-  WriteCmdQMAPTI(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id, 0x1 /*Clctn_ID*/);
-  /* Invalid Entry */
-  WriteCmdQINV(its_index, (uint64_t *)(ItsCommandBase), device_id, int_id);
+  for (i = 0; i < num; i++) {
+    /* Map Device using MAPD */
+    if (!ItsDeviceMapped(state, maps[i].device_id) &&
+        WriteCmdQMAPD(its_index, maps[i].device_id, g_gic_its_info->GicIts[its_index].ITTBase,
+                      g_gic_its_info->GicIts[its_index].IDBits, 0x1 /*Valid*/))
+      return ItsCmdQFail(state);
+
+    /* Map Interrupt using MAPTI */
+    if (WriteCmdQMAPTI(its_index, maps[i].device_id, maps[i].int_id, ITS_CLCN_ID))
+      return ItsCmdQFail(state);
+  }
+
+  /* Make the Redistributor reload the configuration of the new LPIs */
+  if (WriteCmdQINVALL(its_index, ITS_CLCN_ID))
+    return ItsCmdQFail(state);
   /* ITS SYNC Command */
-  WriteCmdQSYNC(its_index, (uint64_t *)(ItsCommandBase), RDBase);
+  if (WriteCmdQSYNC(its_index, state->rd_base))
+    return ItsCmdQFail(state);
 
-  dsbsy();
+  /* Update CWRITER and check CREADR which ensures Command Queue is processed */
+  if (PollTillCommandQueueDone(its_index))
+    return ItsCmdQFail(state);
 
-  /* Update the CWRITER Register so that all the commands from Command queue gets executed.*/
-  value = ((g_cwriter_ptr[its_index] * NUM_BYTES_IN_DW));
-  val_mmio_write64((ItsBase + ARM_GITS_CWRITER), value);
+  return 0;
+}
 
-  /* Check CREADR value which ensures Command Queue is processed */
-  PollTillCommandQueueDone(its_index);
-  dsbsy();
+uint32_t val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
+                                uint32_t int_id, uint32_t Priority)
+{
+  ITS_LPI_MAP map;
 
+  map.device_id = device_id;
+  map.int_id = int_id;
+  return val_its_create_lpi_maps(its_index, &map, 1, Priority);
 }
 
 
@@ -627,17 +759,16 @@ uint32_t val_its_init(void)
   uint32_t    Status;
   uint32_t    index;
 
-  g_cwriter_ptr = (uint32_t *)pal_aligned_alloc(MEM_ALIGN_4K,
-                                                sizeof(uint32_t) * (g_gic_its_info->GicNumIts));
+  if (g_its_cmdq != NULL)
+    val_memory_free(g_its_cmdq);
 
-  if (g_cwriter_ptr == NULL) {
+  g_its_cmdq = val_memory_calloc(g_gic_its_info->GicNumIts, sizeof(ITS_CMDQ_STATE));
+
+  if (g_its_cmdq == NULL) {
     val_print(ERROR, "ITS : Could Not Allocate Memory CWriteR. Test may not pass.\n");
     return 0;
   }
 
-  for (index = 0; index < g_gic_its_info->GicNumIts; index++)
-    g_cwriter_ptr[index] = 0;
-
   for (index = 0; index < g_gic_its_info->GicNumIts; index++)
   {
     /* Set Initial configuration */   // DONE
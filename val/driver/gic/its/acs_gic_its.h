@@ -130,6 +130,7 @@
 
 /* GITS_CREADR Bits */
 #define ARM_GITS_CREADR_STALL       (1 << 0)
+#define ARM_GITS_CREADR_OFFSET_MASK (0xFFFE0)
 
 /* GITS_CWRITER Bits */
 #define ARM_GITS_CWRITER_RETRY      (1 << 0)
@@ -173,6 +174,7 @@
 #define ARM_ITS_CMD_MAPI    0xB
 #define ARM_ITS_CMD_MAPTI   0xA
 #define ARM_ITS_CMD_INV     0xC
+#define ARM_ITS_CMD_INVALL  0xD
 #define ARM_ITS_CMD_DISCARD 0xF
 #define ARM_ITS_CMD_SYNC    0x5
 
@@ -184,6 +186,31 @@
 #define ITS_NEXT_CMD_PTR    4
 #define NUM_BYTES_IN_DW     8
 
+/* Commands are 4 double words, the command queue is a ring of NUM_PAGES_8 pages */
+#define ITS_CMD_SIZE        (ITS_NEXT_CMD_PTR * NUM_BYTES_IN_DW)
+#define ITS_CMDQ_SIZE       (NUM_PAGES_8 * SIZE_4KB)
+#define ITS_CLCN_ID         0x1
+#define ITS_MAPPED_DEV_MAX  32
+
+/* Command queue state of an ITS. cwriter shadows GITS_CWRITER and is only
+   written to the register when a batch is published, creadr caches
+   GITS_CREADR. Both are byte offsets into the command queue. Devices which
+   already had a valid MAPD are remembered so that MAPD is sent once per
+   device, up to ITS_MAPPED_DEV_MAX devices. */
+typedef struct {
+  uint32_t cwriter;
+  uint32_t creadr;
+  uint32_t clctn_mapped;
+  uint64_t rd_base;
+  uint32_t num_mapped_dev;
+  uint32_t mapped_dev[ITS_MAPPED_DEV_MAX];
+} ITS_CMDQ_STATE;
+
+typedef struct {
+  uint32_t device_id;
+  uint32_t int_id;
+} ITS_LPI_MAP;
+
 uint32_t ArmGicRedistributorConfigurationForLPI(uint64_t rd_base);
 
 void ClearConfigTable(uint32_t int_id);
@@ -194,9 +221,11 @@ uint32_t val_its_gicr_lpi_support(uint64_t rd_base);
 
 
 void EnableLPIsRD(uint64_t rd_base);
-void val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
-                            uint32_t int_id, uint32_t Priority);
-void val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id);
+uint32_t val_its_create_lpi_map(uint32_t its_index, uint32_t device_id,
+                                uint32_t int_id, uint32_t Priority);
+uint32_t val_its_create_lpi_maps(uint32_t its_index, ITS_LPI_MAP *maps, uint32_t num,
+                                 uint32_t Priority);
+uint32_t val_its_clear_lpi_map(uint32_t its_index, uint32_t device_id, uint32_t int_id);
 
 uint64_t val_its_get_translater_addr(uint32_t its_index);
 uint32_t val_its_get_max_lpi(void);
@@ -109,6 +109,9 @@ BITFIELD_DECL(uint32_t, STRTAB_BASE_CFG_LOG2SIZE, 5, 0)
 #define SMMU_EVNTQ_CONS_OFFSET 0xac
 
 BITFIELD_DECL(uint32_t, EVTQ_0_ID, 7, 0)
+#define EVTQ_0_SSV (1ULL << 11)
+BITFIELD_DECL(uint64_t, EVTQ_0_SSID, 31, 12)
+BITFIELD_DECL(uint64_t, EVTQ_0_SID, 63, 32)
 BITFIELD_DECL(uint64_t, MSI_MASK, 51, 2)
 
 #define EVT_ID_UUT               0x01
@@ -146,6 +149,7 @@ BITFIELD_DECL(uint64_t, QUEUE_BASE_LOG2SIZE, 4, 0)
 
 #define STRTAB_L1_SZ_SHIFT 20
 #define STRTAB_SPLIT       8
+#define STRTAB_L2_POOL_BATCH 8
 
 #define STRTAB_L1_DESC_DWORDS 1
 #define STRTAB_L1_DESC_SIZE   8
@@ -201,9 +205,20 @@ BITFIELD_DECL(uint64_t, STRTAB_STE_3_S2TTB, 51, 4)
 #define CMDQ_DWORDS_PER_ENT  2
 #define EVNTQ_DWORDS_PER_ENT 4
 BITFIELD_DECL(uint64_t, CMDQ_0_OP, 7, 0)
+BITFIELD_DECL(uint64_t, CMDQ_CFGI_0_SID, 63, 32)
 BITFIELD_DECL(uint64_t, CMDQ_CFGI_1_RANGE, 4, 0)
 #define CMDQ_CFGI_1_ALL_STES 31
 
+/* CMD_SYNC completion signal, with CS_IRQ the SMMU writes MSIDATA to
+   MSIADDR once all prior commands have completed */
+BITFIELD_DECL(uint64_t, CMDQ_SYNC_0_CS, 13, 12)
+#define CMDQ_SYNC_0_CS_NONE  0
+#define CMDQ_SYNC_0_CS_IRQ   1
+BITFIELD_DECL(uint64_t, CMDQ_SYNC_0_MSH, 23, 22)
+BITFIELD_DECL(uint64_t, CMDQ_SYNC_0_MSIATTR, 27, 24)
+#define CMDQ_SYNC_MSIATTR_OIWB 0xF
+#define CMDQ_SYNC_1_MSIADDR_MASK (((1ULL << 50) - 1) << 2)
+
 #define SMMU_CMDQ_POLL_TIMEOUT 0x100000
 
 #define CDTAB_SPLIT             10
@@ -23,7 +23,12 @@ uint32_t    g_smmu_index;
 uint64_t    g_page1_base;
 extern uint32_t g_num_smmus;
 
-struct smmu_master_node *g_smmu_master_list_head = NULL;
+/* Masters indexed by (SMMU, StreamID). The map, the masters and their CD
+   tables persist across tests so that a later map of the same StreamID reuses
+   them, and are only released by val_smmu_stop(). */
+static smmu_master_map_entry_t *g_smmu_master_map;
+static uint32_t g_smmu_master_map_size;
+static uint32_t g_smmu_master_map_count;
 
 static uint64_t align_to_size(uint64_t addr,  uint64_t size)
 {
@@ -40,14 +45,6 @@ static uint32_t smmu_inc_cons(smmu_queue_t *q)
     return (q->cons + 1) & ((0x1ul << (q->log2nent + 1)) - 1);
 }
 
-static uint32_t smmu_queue_full(smmu_queue_t *q)
-{
-    uint32_t index_mask = ((0x1ul << q->log2nent) - 1);
-    uint32_t wrap_mask = (0x1ul << q->log2nent);
-    return ((q->prod & index_mask) == (q->cons & index_mask)) &&
-           ((q->prod & wrap_mask) != (q->cons & wrap_mask));
-}
-
 static uint32_t smmu_queue_empty(smmu_queue_t *q)
 {
     uint32_t index_mask = ((0x1ul << q->log2nent) - 1);
@@ -56,7 +53,10 @@ static uint32_t smmu_queue_empty(smmu_queue_t *q)
            ((q->prod & wrap_mask) == (q->cons & wrap_mask));
 }
 
-static int smmu_cmdq_build_cmd(uint64_t *cmd, uint8_t opcode)
+/* sid and range are only used by the CFGI_STE and CFGI_STE_RANGE commands,
+   CFGI_STE_RANGE covers the 2^(range + 1) StreamIDs of the aligned block
+   holding sid */
+static int smmu_cmdq_build_cmd(uint64_t *cmd, uint8_t opcode, uint32_t sid, uint32_t range)
 {
     val_memory_set(cmd, CMDQ_DWORDS_PER_ENT << 3, 0);
     cmd[0] |= BITFIELD_SET(CMDQ_0_OP, opcode);
@@ -66,8 +66,12 @@ static int smmu_cmdq_build_cmd(uint64_t *cmd, uint8_t opcode)
     case CMDQ_OP_TLBI_NSNH_ALL:
     case CMDQ_OP_CMD_SYNC:
         break;
-    case CMDQ_OP_CFGI_ALL:
-        cmd[1] |= BITFIELD_SET(CMDQ_CFGI_1_RANGE, CMDQ_CFGI_1_ALL_STES);
+    case CMDQ_OP_CFGI_STE:
+        cmd[0] |= BITFIELD_SET(CMDQ_CFGI_0_SID, (uint64_t)sid);
+        break;
+    case CMDQ_OP_CFGI_STE_RANGE:
+        cmd[0] |= BITFIELD_SET(CMDQ_CFGI_0_SID, (uint64_t)sid);
+        cmd[1] |= BITFIELD_SET(CMDQ_CFGI_1_RANGE, (uint64_t)range);
         break;
     default:
         val_print(ERROR, "\n       Unsupported SMMU command 0x%x    ", opcode);
@@ -77,79 +81,168 @@ static int smmu_cmdq_build_cmd(uint64_t *cmd, uint8_t opcode)
     return 0;
 }
 
-static int smmu_cmdq_write_cmd(smmu_dev_t *smmu, uint64_t *cmd)
+static void smmu_cmdq_poll_until_consumed(smmu_dev_t *smmu)
 {
     uint32_t timeout = SMMU_CMDQ_POLL_TIMEOUT;
-    int ret = 0, i;
-    uint64_t *cmd_dst;
     smmu_cmd_queue_t *cmdq = &smmu->cmdq;
-    smmu_queue_t
-        queue =
-            {
-                .log2nent = cmdq->queue.log2nent,
+    smmu_queue_t queue = {
+                .log2nent = smmu->cmdq.queue.log2nent,
+                .prod = val_mmio_read((uint64_t)smmu->cmdq.prod_reg),
+                .cons = val_mmio_read((uint64_t)smmu->cmdq.cons_reg)
             };
 
-    while (smmu_queue_full(&cmdq->queue) && timeout) {
+    while (timeout > 0) {
+        if (smmu_queue_empty(&queue))
+            break;
+        queue.cons = val_mmio_read((uint64_t)cmdq->cons_reg);
         timeout--;
     }
 
     if (!timeout) {
-        val_print(ERROR, "\n       SMMU CMD queue is full     ");
-        return -1;
+        val_print(ERROR, "\n       CMDQ poll timeout at 0x%08x", queue.prod);
+        val_print(ERROR, "\n       prod_reg = 0x%08x,",
+val_mmio_read((uint64_t)smmu->cmdq.prod_reg));
+        val_print(ERROR, "\n       cons_reg = 0x%08x",
+val_mmio_read((uint64_t)smmu->cmdq.cons_reg));
+        val_print(ERROR, "\n       gerror   = 0x%08x     ",
+val_mmio_read(smmu->base + SMMU_GERROR_OFFSET));
     }
+}
+
+static uint32_t smmu_cmdq_index_mask(smmu_cmd_queue_t *cmdq)
+{
+    /* Index plus wrap bit */
+    return (0x1ul << (cmdq->queue.log2nent + 1)) - 1;
+}
 
-    queue.prod = val_mmio_read((uint64_t)cmdq->prod_reg);
-    cmd_dst = (uint64_t *)(cmdq->base + ((queue.prod & ((0x1ull << queue.log2nent) - 1)) * (cmdq->entry_size)));
-    for (i = 0; i < CMDQ_DWORDS_PER_ENT; ++i)
-        cmd_dst[i] = cmd[i];
-    queue.prod = smmu_inc_prod(&queue);
+static uint32_t smmu_cmdq_space(smmu_cmd_queue_t *cmdq)
+{
+    uint32_t used = (cmdq->queue.prod - cmdq->queue.cons) & smmu_cmdq_index_mask(cmdq);
+
+    return (0x1ul << cmdq->queue.log2nent) - used;
+}
 
+static uint64_t *smmu_cmdq_slot(smmu_cmd_queue_t *cmdq, uint32_t prod)
+{
+    return (uint64_t *)(cmdq->base +
+                        ((prod & ((0x1ull << cmdq->queue.log2nent) - 1)) * cmdq->entry_size));
+}
+
+static void smmu_cmdq_publish(smmu_cmd_queue_t *cmdq)
+{
 #ifndef TARGET_LINUX
     dmbsy();
 #endif
-    val_mmio_write((uint64_t)cmdq->prod_reg, queue.prod);
-
-    return ret;
+    val_mmio_write((uint64_t)cmdq->prod_reg, cmdq->queue.prod);
 }
 
-static int smmu_cmdq_issue_cmd(smmu_dev_t *smmu,
-                   uint8_t opcode)
+static int smmu_cmdq_wait_space(smmu_dev_t *smmu)
 {
-    uint64_t cmd[CMDQ_DWORDS_PER_ENT];
+    uint32_t timeout = SMMU_CMDQ_POLL_TIMEOUT;
+    smmu_cmd_queue_t *cmdq = &smmu->cmdq;
 
-    if (smmu_cmdq_build_cmd(cmd, opcode)) {
-        return -1;
+    /* The SMMU can only drain what has been published */
+    smmu_cmdq_publish(cmdq);
+
+    while (smmu_cmdq_space(cmdq) == 0) {
+        if (!timeout--) {
+            val_print(ERROR, "\n       SMMU CMD queue is full     ");
+            return -1;
+        }
+        cmdq->queue.cons = val_mmio_read((uint64_t)cmdq->cons_reg) &
+                           smmu_cmdq_index_mask(cmdq);
     }
 
-    return smmu_cmdq_write_cmd(smmu, cmd);
+    return 0;
 }
 
-static void smmu_cmdq_poll_until_consumed(smmu_dev_t *smmu)
+/* The CMD_SYNC signals completion by overwriting the low word of its own
+   queue entry with zero, which needs MSI support and coherent access */
+static uint32_t smmu_cmdq_sync_msi(smmu_dev_t *smmu)
+{
+    return smmu->supported.msi && smmu->supported.cohacc;
+}
+
+static void smmu_cmdq_build_sync(smmu_dev_t *smmu, uint64_t *cmd, uint32_t prod)
+{
+    smmu_cmd_queue_t *cmdq = &smmu->cmdq;
+    uint64_t slot_phys = cmdq->base_phys +
+                         ((prod & ((0x1ull << cmdq->queue.log2nent) - 1)) * cmdq->entry_size);
+
+    cmd[1] = 0;
+    cmd[0] = BITFIELD_SET(CMDQ_0_OP, CMDQ_OP_CMD_SYNC);
+
+    if (smmu_cmdq_sync_msi(smmu)) {
+        cmd[1] = slot_phys & CMDQ_SYNC_1_MSIADDR_MASK;
+        cmd[0] |= BITFIELD_SET(CMDQ_SYNC_0_CS, CMDQ_SYNC_0_CS_IRQ) |
+                  BITFIELD_SET(CMDQ_SYNC_0_MSH, SMMU_SH_ISH) |
+                  BITFIELD_SET(CMDQ_SYNC_0_MSIATTR, CMDQ_SYNC_MSIATTR_OIWB);
+    }
+}
+
+static int smmu_cmdq_wait_sync(smmu_dev_t *smmu, uint32_t sync_prod)
 {
     uint32_t timeout = SMMU_CMDQ_POLL_TIMEOUT;
     smmu_cmd_queue_t *cmdq = &smmu->cmdq;
-    smmu_queue_t queue = {
-                .log2nent = smmu->cmdq.queue.log2nent,
-                .prod = val_mmio_read((uint64_t)smmu->cmdq.prod_reg),
-                .cons = val_mmio_read((uint64_t)smmu->cmdq.cons_reg)
-            };
+    volatile uint32_t *msi = (volatile uint32_t *)smmu_cmdq_slot(cmdq, sync_prod);
 
-    while (timeout > 0) {
-        if (smmu_queue_empty(&queue))
-            break;
-        queue.cons = val_mmio_read((uint64_t)cmdq->cons_reg);
-        timeout--;
+    if (smmu_cmdq_sync_msi(smmu)) {
+        while (timeout--) {
+            if (*msi == 0) {
+                cmdq->queue.cons = cmdq->queue.prod;
+                return 0;
+            }
+        }
+        val_print(WARN, "\n       CMD_SYNC MSI not seen, polling CONS     ");
     }
 
-    if (!timeout) {
-        val_print(ERROR, "\n       CMDQ poll timeout at 0x%08x", queue.prod);
-        val_print(ERROR, "\n       prod_reg = 0x%08x,",
-val_mmio_read((uint64_t)smmu->cmdq.prod_reg));
-        val_print(ERROR, "\n       cons_reg = 0x%08x",
-val_mmio_read((uint64_t)smmu->cmdq.cons_reg));
-        val_print(ERROR, "\n       gerror   = 0x%08x     ",
-val_mmio_read(smmu->base + SMMU_GERROR_OFFSET));
+    smmu_cmdq_poll_until_consumed(smmu);
+    cmdq->queue.cons = val_mmio_read((uint64_t)cmdq->cons_reg) & smmu_cmdq_index_mask(cmdq);
+
+    return 0;
+}
+
+/**
+  @brief Write a batch of commands at the shadow producer index and publish
+         them with a single PROD update. With sync set, a CMD_SYNC is
+         appended and the call returns once the SMMU has completed it.
+  @param smmu - SMMU device
+  @param cmds - num commands of CMDQ_DWORDS_PER_ENT double words each
+  @param num  - number of commands
+  @param sync - append a CMD_SYNC and wait for its completion
+  @return 0 on success
+**/
+static int smmu_cmdq_issue_cmdlist(smmu_dev_t *smmu, uint64_t *cmds, uint32_t num,
+                                   uint32_t sync)
+{
+    smmu_cmd_queue_t *cmdq = &smmu->cmdq;
+    uint64_t *cmd_dst;
+    uint32_t i, j, sync_prod;
+
+    for (i = 0; i < num; i++) {
+        if ((smmu_cmdq_space(cmdq) == 0) && smmu_cmdq_wait_space(smmu))
+            return -1;
+
+        cmd_dst = smmu_cmdq_slot(cmdq, cmdq->queue.prod);
+        for (j = 0; j < CMDQ_DWORDS_PER_ENT; ++j)
+            cmd_dst[j] = cmds[i * CMDQ_DWORDS_PER_ENT + j];
+        cmdq->queue.prod = smmu_inc_prod(&cmdq->queue);
+    }
+
+    if (!sync) {
+        smmu_cmdq_publish(cmdq);
+        return 0;
     }
+
+    if ((smmu_cmdq_space(cmdq) == 0) && smmu_cmdq_wait_space(smmu))
+        return -1;
+
+    sync_prod = cmdq->queue.prod;
+    smmu_cmdq_build_sync(smmu, smmu_cmdq_slot(cmdq, sync_prod), sync_prod);
+    cmdq->queue.prod = smmu_inc_prod(&cmdq->queue);
+    smmu_cmdq_publish(cmdq);
+
+    return smmu_cmdq_wait_sync(smmu, sync_prod);
 }
 
 static void smmu_strtab_write_ste(smmu_master_t *master, uint64_t *ste)
@@ -268,7 +361,8 @@ static uint32_t smmu_evnt_queue_init(smmu_dev_t *smmu)
     smmu_evnt_queue_t *evntq = &smmu->evntq;
     uint64_t evntq_size = ((1 << evntq->queue.log2nent) * EVNTQ_DWORDS_PER_ENT) << 3;
     evntq_size = (evntq_size < 64)?64:evntq_size;
-    evntq->base_ptr = val_memory_calloc (1, evntq_size);
+    /* Twice the queue size so the base can be aligned to it */
+    evntq->base_ptr = val_memory_calloc (2, evntq_size);
     if (!evntq->base_ptr) {
         val_print(ERROR, "\n      Failed to allocate Event queue struct.     ");
         return 0;
@@ -301,6 +395,7 @@ static void smmu_free_strtab(smmu_dev_t *smmu)
     if (smmu->supported.st_level_2lvl &&
         cfg->l1_desc != NULL)
     {
+        /* Only the descriptor owning the start of a pool chunk holds l2ptr */
         for (i = 0; i < cfg->l1_ent_count; ++i)
         {
             if (cfg->l1_desc[i].l2ptr != NULL)
@@ -324,33 +419,61 @@ smmu_strtab_write_level1_desc(uint64_t *dst, smmu_strtab_l1_desc_t *desc)
     *dst = val;
 }
 
-static int smmu_strtab_init_level2(smmu_dev_t *smmu, uint32_t sid)
+/* Allocate a chunk of STRTAB_L2_POOL_BATCH L2 tables, each aligned to its size,
+   with every STE set to abort. The chunk is owned by desc. */
+static int smmu_strtab_l2_pool_refill(smmu_dev_t *smmu, smmu_strtab_l1_desc_t *desc)
 {
     uint64_t size, *ste;
+    uint32_t i;
+    smmu_strtab_config_t *cfg = &smmu->strtab_cfg;
+
+    size = (1 << STRTAB_SPLIT) * STRTAB_STE_DWORDS * BYTES_PER_DWORD;
+    val_memory_persist_begin();
+    desc->l2ptr = val_memory_calloc(STRTAB_L2_POOL_BATCH + 1, size);
+    val_memory_persist_end();
+    if (!desc->l2ptr)
+        return 0;
+
+    cfg->l2_pool = (uint64_t *)align_to_size((uint64_t)desc->l2ptr, size);
+    cfg->l2_pool_phys = align_to_size((uint64_t)val_memory_virt_to_phys(desc->l2ptr), size);
+    cfg->l2_pool_free = STRTAB_L2_POOL_BATCH;
+
+    for (ste = cfg->l2_pool, i = 0; i < (STRTAB_L2_POOL_BATCH << STRTAB_SPLIT);
+         ++i, ste += STRTAB_STE_DWORDS)
+        smmu_strtab_write_ste(NULL, ste);
+
+    return 1;
+}
+
+static int smmu_strtab_init_level2(smmu_dev_t *smmu, uint32_t sid)
+{
+    uint64_t size;
     void *strtab;
-    int i;
     smmu_strtab_config_t *cfg = &smmu->strtab_cfg;
     smmu_strtab_l1_desc_t *desc = &cfg->l1_desc[sid >> STRTAB_SPLIT];
 
-    if (desc->l2ptr)
+    if (desc->l2desc64)
         return 1;
 
+    if (cfg->l2_pool_free == 0) {
+        if (!smmu_strtab_l2_pool_refill(smmu, desc)) {
+            val_print(ERROR, "\n       failed to allocate l2 stream table for SID %u     ",
+sid);
+            return 0;
+        }
+    }
+
     size = (1 << STRTAB_SPLIT) * STRTAB_STE_DWORDS * BYTES_PER_DWORD;
     strtab = &cfg->strtab64[(sid >> STRTAB_SPLIT) * STRTAB_L1_DESC_DWORDS];
 
     desc->span = STRTAB_SPLIT + 1;
-    desc->l2ptr = val_memory_calloc(2, size);
-    if (!desc->l2ptr) {
-        val_print(ERROR, "\n       failed to allocate l2 stream table for SID %u     ",
-sid);
-        return 0;
-    }
+    desc->l2desc64 = cfg->l2_pool;
+    desc->l2desc_phys = cfg->l2_pool_phys;
 
-    desc->l2desc_phys = align_to_size((uint64_t)val_memory_virt_to_phys(desc->l2ptr), size);
-    desc->l2desc64 = (uint64_t*)align_to_size((uint64_t)desc->l2ptr, size);
+    cfg->l2_pool += size / BYTES_PER_DWORD;
+    cfg->l2_pool_phys += size;
+    cfg->l2_pool_free--;
 
-    for (ste = desc->l2desc64, i = 0; i < (1 << STRTAB_SPLIT); ++i, ste += STRTAB_STE_DWORDS)
-        smmu_strtab_write_ste(NULL, ste);
     smmu_strtab_write_level1_desc(strtab, desc);
     return 1;
 }
@@ -442,101 +565,190 @@ static int smmu_reg_write_sync(smmu_dev_t *smmu, uint32_t val,
     return 1;
 }
 
-static smmu_master_t *smmu_master_at(uint32_t sid)
+static uint32_t smmu_master_map_slot(uint64_t key, uint32_t size)
 {
-    struct smmu_master_node *node = g_smmu_master_list_head;
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & (size - 1);
+}
 
-    while (node != NULL)
+static uint32_t smmu_master_map_grow(void)
+{
+    smmu_master_map_entry_t *map;
+    uint32_t size, i, slot;
+
+    size = g_smmu_master_map_size ? (g_smmu_master_map_size << 1) : SMMU_MASTER_MAP_MIN_SIZE;
+    /* The map, masters, STE pool and CD tables live until val_smmu_stop(),
+       they are not owned by a test arena */
+    val_memory_persist_begin();
+    map = val_memory_calloc(size, sizeof(smmu_master_map_entry_t));
+    val_memory_persist_end();
+    if (map == NULL)
+        return 0;
+
+    for (i = 0; i < g_smmu_master_map_size; i++)
     {
-        if (node->master->sid == sid)
-            return node->master;
-        node = node->next;
+        if (g_smmu_master_map[i].master == NULL)
+            continue;
+        slot = smmu_master_map_slot(g_smmu_master_map[i].key, size);
+        while (map[slot].master != NULL)
+            slot = (slot + 1) & (size - 1);
+        map[slot] = g_smmu_master_map[i];
     }
 
-    node = val_memory_alloc(sizeof(struct smmu_master_node));
-    if (node == NULL)
-        return NULL;
+    if (g_smmu_master_map)
+        val_memory_free(g_smmu_master_map);
+    g_smmu_master_map = map;
+    g_smmu_master_map_size = size;
+
+    return 1;
+}
 
-    node->master = val_memory_calloc(1, sizeof(smmu_master_t));
-    if (node->master == NULL)
+/**
+  @brief Find the master for a StreamID of an SMMU, creating it when create
+         is set. Masters stay in the map after unmap so their tables can be
+         reused, and are only freed by val_smmu_stop().
+**/
+static smmu_master_t *smmu_master_at(uint32_t smmu_index, uint32_t sid, uint32_t create)
+{
+    uint64_t key = ((uint64_t)smmu_index << 32) | sid;
+    smmu_master_t *master;
+    uint32_t slot;
+
+    if (g_smmu_master_map_size)
     {
-        val_memory_free(node);
+        slot = smmu_master_map_slot(key, g_smmu_master_map_size);
+        while (g_smmu_master_map[slot].master != NULL)
+        {
+            if (g_smmu_master_map[slot].key == key)
+                return g_smmu_master_map[slot].master;
+            slot = (slot + 1) & (g_smmu_master_map_size - 1);
+        }
+    }
+
+    if (!create)
         return NULL;
+
+    if (((g_smmu_master_map_count + 1) << 1) > g_smmu_master_map_size)
+    {
+        if (!smmu_master_map_grow())
+            return NULL;
     }
 
-    node->next = g_smmu_master_list_head;
-    g_smmu_master_list_head = node;
+    val_memory_persist_begin();
+    master = val_memory_calloc(1, sizeof(smmu_master_t));
+    val_memory_persist_end();
+    if (master == NULL)
+        return NULL;
 
-    return node->master;
+    slot = smmu_master_map_slot(key, g_smmu_master_map_size);
+    while (g_smmu_master_map[slot].master != NULL)
+        slot = (slot + 1) & (g_smmu_master_map_size - 1);
+    g_smmu_master_map[slot].key = key;
+    g_smmu_master_map[slot].master = master;
+    g_smmu_master_map_count++;
+
+    return master;
 }
 
-// Event handler. Gives the info of the kind of event error generated.
-static int smmu_handle_evt(uint64_t *event)
+static smmu_event_hist_t g_smmu_event_hist[SMMU_EVT_HIST_SIZE];
+static uint32_t g_smmu_event_hist_dropped;
+
+// Gives the info of the kind of event error generated.
+static const char *smmu_evt_name(uint8_t id)
 {
-        switch (BITFIELD_GET(EVTQ_0_ID, event[0])) {
+        switch (id) {
         case EVT_ID_UUT:
-                val_print(INFO, "\n\n    Unsupported Upstream Transaction     ");
-                break;
+                return "Unsupported Upstream Transaction";
         case EVT_ID_TRANSID_FAULT:
-                val_print(INFO, "\n\n    Transaction StreamID out of range     ");
-                break;
+                return "Transaction StreamID out of range";
         case EVT_ID_STE_FETCH_FAULT:
-                val_print(INFO, "\n\n    Fetch of STE caused external abort     ");
-                break;
+                return "Fetch of STE caused external abort";
         case EVT_ID_BAD_STE:
-                val_print(INFO, "\n\n    Used STE invalid     ");
-                break;
+                return "Used STE invalid";
         case EVT_ID_BAD_ATS_TREQ:
-                val_print(INFO, "\n\n    Address Translation Request disallowed   ");
-                break;
+                return "Address Translation Request disallowed";
         case EVT_ID_STREAM_DISABLED:
-                val_print(INFO, "\n\n    Non-substream transactions disabled     ");
-                break;
+                return "Non-substream transactions disabled";
         case EVT_ID_TRANSL_FORBIDDEN:
-                val_print(INFO, "\n\n    Forbidden translation     ");
-                break;
+                return "Forbidden translation";
         case EVT_ID_BAD_SSID:
-                val_print(INFO, "\n\n    Bad Substream ID     ");
-                break;
+                return "Bad Substream ID";
         case EVT_ID_CD_FETCH_FAULT:
-                val_print(INFO, "\n\n    Fetch of CD caused external abort     ");
-                break;
+                return "Fetch of CD caused external abort";
         case EVT_ID_BAD_CD:
-                val_print(INFO, "\n\n    Fetched CD invalid     ");
-                break;
+                return "Fetched CD invalid";
         case EVT_ID_WALK_EABT:
-                val_print(INFO, "\n\n    Fetch of TTD caused external abort");
-                break;
+                return "Fetch of TTD caused external abort";
         case EVT_ID_TRANSLATION_FAULT:
-                val_print(INFO, "\n\n    SMMU_FAULT_REASON_PTE_FETCH     ");
-                break;
+                return "SMMU_FAULT_REASON_PTE_FETCH";
         case EVT_ID_ADDR_SIZE_FAULT:
-                val_print(INFO, "\n\n    SMMU_FAULT_REASON_OOR_ADDRESS     ");
-                break;
+                return "SMMU_FAULT_REASON_OOR_ADDRESS";
         case EVT_ID_ACCESS_FAULT:
-                val_print(INFO, "\n\n    SMMU_FAULT_REASON_ACCESS     ");
-                break;
+                return "SMMU_FAULT_REASON_ACCESS";
         case EVT_ID_PERMISSION_FAULT:
-                val_print(INFO, "\n\n    SMMU_FAULT_REASON_PERMISSION     ");
-                break;
+                return "SMMU_FAULT_REASON_PERMISSION";
         case EVT_ID_TLB_CONFLICT:
-                val_print(INFO, "\n\n    TLB conflict occurred     ");
-                break;
+                return "TLB conflict occurred";
         case EVT_ID_CFG_CONFLICT:
-                val_print(INFO, "\n\n    Configuration cache conflict occurred    ");
-                break;
+                return "Configuration cache conflict occurred";
         case EVT_ID_PAGE_REQUEST:
-                val_print(INFO, "\n\n    Speculation Page Req hint     ");
-                break;
+                return "Speculation Page Req hint";
         case EVT_ID_VMS_FETCH:
-                val_print(INFO, "\n\n    Fetch of VMS caused external abort     ");
-                break;
+                return "Fetch of VMS caused external abort";
         default:
-                val_print(INFO, "\n\n    INVALID FAULT     ");
-                return 1;
+                return "INVALID FAULT";
         }
+}
 
-    return 0;
+static void smmu_evt_decode(uint64_t *event, smmu_event_record_t *rec)
+{
+    rec->id   = BITFIELD_GET(EVTQ_0_ID, event[0]);
+    rec->sid  = BITFIELD_GET(EVTQ_0_SID, event[0]);
+    rec->ssv  = (event[0] & EVTQ_0_SSV) ? 1 : 0;
+    rec->ssid = rec->ssv ? BITFIELD_GET(EVTQ_0_SSID, event[0]) : 0;
+
+    /* Records carrying an InputAddr hold it in the third double word */
+    switch (rec->id) {
+    case EVT_ID_UUT:
+    case EVT_ID_BAD_ATS_TREQ:
+    case EVT_ID_TRANSL_FORBIDDEN:
+    case EVT_ID_WALK_EABT:
+    case EVT_ID_TRANSLATION_FAULT:
+    case EVT_ID_ADDR_SIZE_FAULT:
+    case EVT_ID_ACCESS_FAULT:
+    case EVT_ID_PERMISSION_FAULT:
+    case EVT_ID_TLB_CONFLICT:
+        rec->addr = event[2];
+        break;
+    default:
+        rec->addr = 0;
+        break;
+    }
+}
+
+static void smmu_evt_hist_add(uint32_t smmu_index, smmu_event_record_t *rec)
+{
+    uint32_t i, slot;
+    smmu_event_hist_t *entry;
+
+    slot = (rec->sid * 31 + rec->id + smmu_index * 131) % SMMU_EVT_HIST_SIZE;
+
+    for (i = 0; i < SMMU_EVT_HIST_SIZE; i++) {
+        entry = &g_smmu_event_hist[(slot + i) % SMMU_EVT_HIST_SIZE];
+
+        if (entry->count == 0) {
+            entry->smmu_index = smmu_index;
+            entry->sid = rec->sid;
+            entry->id = rec->id;
+        } else if ((entry->smmu_index != smmu_index) || (entry->sid != rec->sid) ||
+                   (entry->id != rec->id)) {
+            continue;
+        }
+
+        entry->count++;
+        return;
+    }
+
+    g_smmu_event_hist_dropped++;
 }
 
 static void smmu_queue_read(smmu_evnt_queue_t *evntq, uint64_t *event)
@@ -552,20 +764,6 @@ static void smmu_queue_read(smmu_evnt_queue_t *evntq, uint64_t *event)
     return;
 }
 
-
-static int smmu_queue_remove_raw(smmu_evnt_queue_t *evntq, uint64_t *event)
-{
-    if (smmu_queue_empty(&evntq->queue))
-    {
-        return 1;
-    }
-
-    smmu_queue_read(evntq, event);
-    evntq->queue.cons = smmu_inc_cons(&evntq->queue);
-    val_mmio_write((uint64_t)evntq->cons_reg, evntq->queue.cons);
-    return 0;
-}
-
 static int queue_sync_prod_in(smmu_evnt_queue_t *evntq)
 {
     uint32_t prod;
@@ -601,11 +799,14 @@ static uint32_t smmu_gerror_check(smmu_dev_t *smmu)
 
 static void smmu_evtq_thread(void)
 {
-    uint32_t i, ret;
+    uint32_t i, ret, drained = 0;
     smmu_dev_t *smmu = &g_smmu[g_smmu_index];
     smmu_evnt_queue_t *evntq = &smmu->evntq;
     smmu_queue_t *queue = &evntq->queue;
     uint64_t event[EVNTQ_DWORDS_PER_ENT];
+    smmu_event_record_t rec;
+    smmu_event_hist_t *entry;
+
     ret = smmu_gerror_check(smmu);
     if (ret)
     {
@@ -613,28 +814,52 @@ static void smmu_evtq_thread(void)
         return;
     }
 
-    do {
-        while (!smmu_queue_remove_raw(evntq, event)) {
-            uint8_t id = BITFIELD_GET(EVTQ_0_ID, event[0]);
-            ret = smmu_handle_evt(event);
-            val_print(INFO, "\n  event 0x%02x received: %d     ", id);
+    if (queue_sync_prod_in(evntq))
+        val_print(WARN, "\n  EVTQ overflow detected -- events lost     ");
+
+    /* Consume every record between the cached CONS and PROD, then release
+       them to the SMMU with a single CONS write */
+    while (!smmu_queue_empty(queue)) {
+        while (!smmu_queue_empty(queue)) {
+            smmu_queue_read(evntq, event);
+            queue->cons = smmu_inc_cons(queue);
+
+            smmu_evt_decode(event, &rec);
+            smmu_evt_hist_add(g_smmu_index, &rec);
+            drained++;
+
+            val_print(TRACE, "\n  event 0x%02x received: %s", rec.id, smmu_evt_name(rec.id));
+            val_print(TRACE, "\n    sid 0x%x ssid 0x%x", rec.sid, rec.ssid);
+            val_print(TRACE, " addr 0x%llx", rec.addr);
             for (i = 0; i < ARRAY_SIZE(event); ++i)
             {
-                val_print(INFO, "\n  0x%016llx     ", (unsigned long long)event[i]);
+                val_print(TRACE, "\n  0x%016llx     ", (unsigned long long)event[i]);
             }
-
-            val_print(TRACE, "\n  prod is: %x", val_mmio_read((uint64_t)evntq->prod_reg));
-            val_print(TRACE, "\n  cons is: %x", val_mmio_read((uint64_t)evntq->cons_reg));
         }
 
+        /* Acknowledge an overflow along with the consumed records */
+        val_mmio_write((uint64_t)evntq->cons_reg,
+                       (queue->prod & SMMU_QUEUE_OVERFLOW_FLAG) | queue->cons);
+
         if (queue_sync_prod_in(evntq))
             val_print(WARN, "\n  EVTQ overflow detected -- events lost     ");
-    } while (!smmu_queue_empty(&evntq->queue));
+    }
 
-    if (val_mmio_read((uint64_t)evntq->prod_reg) == val_mmio_read((uint64_t)evntq->cons_reg))
+    if (drained == 0)
     {
         val_print(INFO, "\n  No outstanding events in the queue. Queue Empty.\n");
     }
+    else
+    {
+        val_print(INFO, "\n  %d events drained", drained);
+        for (i = 0; i < SMMU_EVT_HIST_SIZE; i++) {
+            entry = &g_smmu_event_hist[i];
+            if ((entry->count == 0) || (entry->smmu_index != g_smmu_index))
+                continue;
+            val_print(INFO, "\n    sid 0x%x event 0x%02x", entry->sid, entry->id);
+            val_print(INFO, " (%s) count %d", smmu_evt_name(entry->id), entry->count);
+        }
+    }
 
     evntq->queue.cons = ((queue->prod) & (1 << 31)) |
                         ((queue->cons) & (1 << queue->log2nent)) |
@@ -653,18 +878,66 @@ static int smmu_dev_disable(smmu_dev_t *smmu)
     return ret;
 }
 
-static void smmu_tlbi_cfgi(smmu_dev_t *smmu)
+/* Invalidate the cached configuration of the StreamIDs in [first_sid, last_sid]
+   together with the CDs fetched through them, and all TLB entries */
+static void smmu_tlbi_cfgi_range(smmu_dev_t *smmu, uint32_t first_sid, uint32_t last_sid)
 {
-    /* Invalidate any cached configuration */
-    smmu_cmdq_issue_cmd(smmu, CMDQ_OP_CFGI_ALL);
+    uint64_t cmds[3 * CMDQ_DWORDS_PER_ENT];
+    uint32_t num = 0;
+    uint32_t range = 0;
+
+    if (first_sid == last_sid) {
+        smmu_cmdq_build_cmd(&cmds[num++ * CMDQ_DWORDS_PER_ENT], CMDQ_OP_CFGI_STE,
+                            first_sid, 0);
+    } else {
+        while ((range < CMDQ_CFGI_1_ALL_STES) &&
+               ((first_sid >> (range + 1)) != (last_sid >> (range + 1))))
+            range++;
+        smmu_cmdq_build_cmd(&cmds[num++ * CMDQ_DWORDS_PER_ENT], CMDQ_OP_CFGI_STE_RANGE,
+                            first_sid, range);
+    }
+
     if (smmu->supported.hyp) {
-        smmu_cmdq_issue_cmd(smmu, CMDQ_OP_TLBI_EL2_ALL);
+        smmu_cmdq_build_cmd(&cmds[num++ * CMDQ_DWORDS_PER_ENT], CMDQ_OP_TLBI_EL2_ALL, 0, 0);
     }
 
-    smmu_cmdq_issue_cmd(smmu, CMDQ_OP_TLBI_NSNH_ALL);
-    smmu_cmdq_issue_cmd(smmu, CMDQ_OP_CMD_SYNC);
+    smmu_cmdq_build_cmd(&cmds[num++ * CMDQ_DWORDS_PER_ENT], CMDQ_OP_TLBI_NSNH_ALL, 0, 0);
 
-    smmu_cmdq_poll_until_consumed(smmu);
+    smmu_cmdq_issue_cmdlist(smmu, cmds, num, 1);
+}
+
+static void smmu_tlbi_cfgi(smmu_dev_t *smmu)
+{
+    /* Range 31 invalidates every STE */
+    smmu_tlbi_cfgi_range(smmu, 0, 0xFFFFFFFF);
+}
+
+static void smmu_cfgi_flush(smmu_dev_t *smmu)
+{
+    if (!smmu->cfgi_pending)
+        return;
+
+    smmu->cfgi_pending = 0;
+    smmu_tlbi_cfgi_range(smmu, smmu->cfgi_first_sid, smmu->cfgi_last_sid);
+}
+
+/* Record that the STE or CDs of sid changed, the CFGI is issued at once
+   unless a batch is open */
+static void smmu_cfgi_mark(smmu_dev_t *smmu, uint32_t sid)
+{
+    if (!smmu->cfgi_pending) {
+        smmu->cfgi_first_sid = sid;
+        smmu->cfgi_last_sid = sid;
+        smmu->cfgi_pending = 1;
+    } else {
+        if (sid < smmu->cfgi_first_sid)
+            smmu->cfgi_first_sid = sid;
+        if (sid > smmu->cfgi_last_sid)
+            smmu->cfgi_last_sid = sid;
+    }
+
+    if (!smmu->cfgi_batch)
+        smmu_cfgi_flush(smmu);
 }
 
 static int smmu_reset(smmu_dev_t *smmu)
@@ -855,6 +1128,12 @@ static uint32_t smmu_probe(smmu_dev_t *smmu)
     if (data & IDR0_HYP)
         smmu->supported.hyp = 1;
 
+    if (data & IDR0_MSI)
+        smmu->supported.msi = 1;
+
+    if (data & IDR0_COHACC)
+        smmu->supported.cohacc = 1;
+
     if (data & IDR0_S1P)
         smmu->supported.s1p = 1;
 
@@ -958,7 +1237,9 @@ static int smmu_cdtab_alloc_leaf_table(smmu_cdtab_l1_ctx_desc_t *l1_desc)
 {
     uint64_t size = CDTAB_L2_ENTRY_COUNT * (CDTAB_CD_DWORDS << 3);
 
+    val_memory_persist_begin();
     l1_desc->l2ptr = val_memory_alloc(size*2);
+    val_memory_persist_end();
     if (!l1_desc->l2ptr) {
         val_print(ERROR, "\n       failed to allocate context descriptor table     ");
         return 1;
@@ -1039,8 +1320,7 @@ static void smmu_cdtab_free(smmu_master_t *master)
     smmu_cdtab_config_t *cdcfg = &cfg->cdcfg;
     max_contexts = 1 << cfg->s1cdmax;
 
-    if (master->smmu->supported.cd2l &&
-        max_contexts > CDTAB_L2_ENTRY_COUNT)
+    if (cfg->s1fmt == STRTAB_STE_0_S1FMT_64K_L2)
     {
         num_l1_ents = (max_contexts + CDTAB_L2_ENTRY_COUNT - 1)/CDTAB_L2_ENTRY_COUNT;
         for (i = 0; i < num_l1_ents; i++)
@@ -1057,6 +1337,30 @@ static void smmu_cdtab_free(smmu_master_t *master)
     cdcfg->cdtab_ptr = NULL;
 }
 
+/* Invalidate every CD of the master while keeping its tables for the next map */
+static void smmu_cdtab_clear(smmu_master_t *master)
+{
+    uint32_t i;
+    smmu_stage1_config_t *cfg = &master->stage1_config;
+    smmu_cdtab_config_t *cdcfg = &cfg->cdcfg;
+
+    if (cdcfg->cdtab_ptr == NULL)
+        return;
+
+    if (cfg->s1fmt != STRTAB_STE_0_S1FMT_64K_L2)
+    {
+        val_memory_set(cdcfg->cdtab64, cdcfg->l1_ent_count * (CDTAB_CD_DWORDS << 3), 0);
+        return;
+    }
+
+    for (i = 0; i < cdcfg->l1_ent_count; i++)
+    {
+        if (cdcfg->l1_desc[i].l2ptr != NULL)
+            val_memory_set(cdcfg->l1_desc[i].l2desc64,
+                           CDTAB_L2_ENTRY_COUNT * (CDTAB_CD_DWORDS << 3), 0);
+    }
+}
+
 static int smmu_cdtab_alloc(smmu_master_t *master)
 {
     uint64_t l1_tbl_size;
@@ -1071,7 +1375,9 @@ static int smmu_cdtab_alloc(smmu_master_t *master)
         cfg->s1fmt = STRTAB_STE_0_S1FMT_64K_L2;
         cdcfg->l1_ent_count = (cdmax + CDTAB_L2_ENTRY_COUNT - 1)/CDTAB_L2_ENTRY_COUNT;
 
+        val_memory_persist_begin();
         cdcfg->l1_desc = val_memory_calloc(cdcfg->l1_ent_count, sizeof(*cdcfg->l1_desc));
+        val_memory_persist_end();
         if (!cdcfg->l1_desc)
             return 0;
 
@@ -1082,7 +1388,9 @@ static int smmu_cdtab_alloc(smmu_master_t *master)
         l1_tbl_size = cdmax * (CDTAB_CD_DWORDS << 3);
     }
 
+    val_memory_persist_begin();
     cdcfg->cdtab_ptr = val_memory_calloc(2, l1_tbl_size);
+    val_memory_persist_end();
     if (!cdcfg->cdtab_ptr) {
         val_print(ERROR, "\n       smmu_cdtab_alloc: alloc failed     ");
         return 0;
@@ -1128,7 +1436,15 @@ uint64_t val_smmu_map(smmu_master_attributes_t master_attr, pgt_descriptor_t pgt
         return 1;
     }
 
-    if ((master = smmu_master_at(master_attr.streamid)) == NULL)
+    if (master_attr.streamid >= (0x1ul << smmu->sid_bits))
+    {
+        val_print(ERROR,
+        "\n       val_smmu_map: sid %d out of range     ",
+        master_attr.streamid);
+        return 1;
+    }
+
+    if ((master = smmu_master_at(master_attr.smmu_index, master_attr.streamid, 1)) == NULL)
         return 1;
 
     if (master->smmu == NULL)
@@ -1155,14 +1471,6 @@ uint64_t val_smmu_map(smmu_master_attributes_t master_attr, pgt_descriptor_t pgt
         master->ssid = master_attr.substreamid;
     }
 
-    if (master_attr.streamid >= (0x1ul << smmu->sid_bits))
-    {
-        val_print(ERROR,
-        "\n       val_smmu_map: sid %d out of range     ",
-        master_attr.streamid);
-        return 1;
-    }
-
     if (smmu->supported.st_level_2lvl) {
         if(!smmu_strtab_init_level2(smmu, master->sid))
         {
@@ -1187,6 +1495,10 @@ uint64_t val_smmu_map(smmu_master_attributes_t master_attr, pgt_descriptor_t pgt
     {
         smmu_stage1_config_t *cfg = &master->stage1_config;
 
+        /* CD tables are kept across unmap, reallocate only if their size changes */
+        if ((cfg->cdcfg.cdtab_ptr != NULL) && (cfg->s1cdmax != master->ssid_bits))
+            smmu_cdtab_free(master);
+
         cfg->s1cdmax = master->ssid_bits;
         if (cfg->cdcfg.cdtab_ptr == NULL) {
             if (!smmu_cdtab_alloc(master))
@@ -1215,7 +1527,7 @@ uint64_t val_smmu_map(smmu_master_attributes_t master_attr, pgt_descriptor_t pgt
     if (acs_policy_get_print_level() <= TRACE)
         dump_strtab(ste);
 
-    smmu_tlbi_cfgi(smmu);
+    smmu_cfgi_mark(smmu, master->sid);
 
     return 0;
 }
@@ -1228,11 +1540,14 @@ uint32_t val_smmu_config_ste_dcp(smmu_master_attributes_t master_attr, uint32_t
     uint64_t *ste;
     uint32_t dcp_value;
 
-    master = smmu_master_at(master_attr.streamid);
-    if (master == NULL)
+    if ((g_smmu == NULL) || (master_attr.smmu_index >= g_num_smmus))
         return ACS_INVALID_INDEX;
 
-    smmu = &g_smmu[master_attr.smmu_index];
+    master = smmu_master_at(master_attr.smmu_index, master_attr.streamid, 0);
+    if ((master == NULL) || (master->smmu == NULL))
+        return ACS_INVALID_INDEX;
+
+    smmu = master->smmu;
     ste = smmu_strtab_get_ste_for_sid(smmu, master->sid);
 
     if (value == 1)
@@ -1261,23 +1576,56 @@ uint32_t val_smmu_config_ste_dcp(smmu_master_attributes_t master_attr, uint32_t
 void val_smmu_unmap(smmu_master_attributes_t master_attr)
 {
     smmu_master_t *master;
-    uint64_t *strtab;
+    smmu_dev_t *smmu;
 
-    if ((master = smmu_master_at(master_attr.streamid)) == NULL)
+    if ((g_smmu == NULL) || (master_attr.smmu_index >= g_num_smmus))
         return;
 
-    if (master->smmu == NULL)
+    master = smmu_master_at(master_attr.smmu_index, master_attr.streamid, 0);
+    if ((master == NULL) || (master->smmu == NULL))
         return;
 
-    if (master_attr.streamid >= (0x1ul << master->smmu->sid_bits))
+    smmu = master->smmu;
+    smmu_strtab_write_ste(NULL, smmu_strtab_get_ste_for_sid(smmu, master->sid));
+
+    smmu_cdtab_clear(master);
+    smmu_cfgi_mark(smmu, master->sid);
+    master->smmu = NULL;
+}
+
+/**
+  @brief Defer the STE and CD invalidation of val_smmu_map() and val_smmu_unmap()
+         on an SMMU until val_smmu_batch_end(). The masters changed inside the
+         batch must not have DMA in flight before it ends, and page tables
+         unmapped inside the batch must not be freed before it ends.
+  @param smmu_index - index of the SMMU
+  @return void
+**/
+void val_smmu_batch_begin(uint32_t smmu_index)
+{
+    if ((g_smmu == NULL) || (smmu_index >= g_num_smmus))
         return;
 
-    strtab = master->smmu->strtab_cfg.strtab64 + master_attr.streamid * STRTAB_STE_DWORDS;
-    smmu_strtab_write_ste(NULL, strtab);
+    g_smmu[smmu_index].cfgi_batch = 1;
+}
+
+/**
+  @brief Close a val_smmu_batch_begin() batch, issuing a single CFGI_STE_RANGE
+         which covers every StreamID mapped or unmapped in the batch
+  @param smmu_index - index of the SMMU
+  @return void
+**/
+void val_smmu_batch_end(uint32_t smmu_index)
+{
+    smmu_dev_t *smmu;
+
+    if ((g_smmu == NULL) || (smmu_index >= g_num_smmus))
+        return;
 
-    smmu_cdtab_free(master);
-    smmu_tlbi_cfgi(master->smmu);
-    val_memory_set(master, sizeof(smmu_master_t), 0);
+    smmu = &g_smmu[smmu_index];
+    smmu->cfgi_batch = 0;
+    if (smmu->base != 0)
+        smmu_cfgi_flush(smmu);
 }
 
 static uint32_t smmu_init(smmu_dev_t *smmu)
@@ -1315,6 +1663,8 @@ static uint32_t smmu_init(smmu_dev_t *smmu)
 void val_smmu_stop(void)
 {
     smmu_dev_t *smmu;
+    smmu_master_t *master;
+    uint32_t i;
 
     for (g_smmu_index = 0; g_smmu_index < g_num_smmus; g_smmu_index++)
     {
@@ -1329,7 +1679,24 @@ void val_smmu_stop(void)
         smmu_free_strtab(smmu);
     }
 
+    for (i = 0; i < g_smmu_master_map_size; i++)
+    {
+        master = g_smmu_master_map[i].master;
+        if (master == NULL)
+            continue;
+        if (master->stage1_config.cdcfg.cdtab_ptr != NULL)
+            smmu_cdtab_free(master);
+        val_memory_free(master);
+    }
+
+    if (g_smmu_master_map)
+        val_memory_free(g_smmu_master_map);
+    g_smmu_master_map = NULL;
+    g_smmu_master_map_size = 0;
+    g_smmu_master_map_count = 0;
+
     val_memory_free(g_smmu);
+    g_smmu = NULL;
 }
 
 /**
@@ -1419,6 +1786,48 @@ void val_smmu_dump_eventq(void)
         smmu_evtq_thread();
     }
 
+    if (g_smmu_event_hist_dropped)
+        val_print(WARN, "\n      %d events not counted, histogram full",
+                  g_smmu_event_hist_dropped);
+
     val_print(INFO, "\n      Eventq dump finished...    ");
     return;
 }
+
+/**
+  @brief Return the number of events drained from the event queues
+  @param smmu_index - Index of SMMU in global SMMU table, or SMMU_EVT_ANY
+  @param sid        - StreamID, or SMMU_EVT_ANY
+  @param event_id   - Event ID (EVT_ID_*), or SMMU_EVT_ANY
+  @return number of matching events
+**/
+uint32_t val_smmu_event_count(uint32_t smmu_index, uint32_t sid, uint32_t event_id)
+{
+    uint32_t i, count = 0;
+    smmu_event_hist_t *entry;
+
+    for (i = 0; i < SMMU_EVT_HIST_SIZE; i++) {
+        entry = &g_smmu_event_hist[i];
+        if (entry->count == 0)
+            continue;
+        if ((smmu_index != SMMU_EVT_ANY) && (entry->smmu_index != smmu_index))
+            continue;
+        if ((sid != SMMU_EVT_ANY) && (entry->sid != sid))
+            continue;
+        if ((event_id != SMMU_EVT_ANY) && (entry->id != event_id))
+            continue;
+        count += entry->count;
+    }
+
+    return count;
+}
+
+/**
+  @brief Reset the event counts returned by val_smmu_event_count()
+  @return None
+**/
+void val_smmu_event_clear(void)
+{
+    val_memory_set(g_smmu_event_hist, sizeof(g_smmu_event_hist), 0);
+    g_smmu_event_hist_dropped = 0;
+}
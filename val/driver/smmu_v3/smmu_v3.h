@@ -36,7 +36,8 @@ static inline uint64_t get_max(uint64_t x, uint64_t y)
 }
 
 #define CMDQ_OP_CFGI_STE 0x3
-#define CMDQ_OP_CFGI_ALL 0x4
+/* CMD_CFGI_ALL is CMD_CFGI_STE_RANGE with Range 31 */
+#define CMDQ_OP_CFGI_STE_RANGE 0x4
 #define CMDQ_OP_TLBI_EL2_ALL 0x20
 #define CMDQ_OP_TLBI_NSNH_ALL 0x30
 #define CMDQ_OP_CMD_SYNC 0x46
@@ -47,6 +48,9 @@ typedef struct {
     uint32_t log2nent;
 } smmu_queue_t;
 
+/* queue.prod is the shadow of SMMU_CMDQ_PROD, it is only written to the
+   register when a batch of commands is published. queue.cons caches
+   SMMU_CMDQ_CONS and is refreshed when the queue looks full. */
 typedef struct {
     smmu_queue_t queue;
     void    *base_ptr;
@@ -118,6 +122,11 @@ typedef struct {
     uint32_t l1_ent_count;
     uint64_t strtab_base;
     uint32_t strtab_base_cfg;
+    /* L2 tables are carved from chunks of STRTAB_L2_POOL_BATCH tables,
+       only the l1_desc owning the start of a chunk has l2ptr set */
+    uint64_t *l2_pool;
+    uint64_t l2_pool_phys;
+    uint32_t l2_pool_free;
 } smmu_strtab_config_t;
 
 typedef struct {
@@ -138,12 +147,39 @@ typedef struct {
            uint32_t s1p:1;
            uint32_t s2p:1;
            uint32_t msi:1;
+           uint32_t cohacc:1;
         };
         uint32_t bitmap;
     } supported;
     uint64_t msi_address;
+    /* StreamIDs whose STE or CDs changed since the last CFGI. The CFGI is
+       deferred while a val_smmu_batch_begin() batch is open. */
+    uint32_t cfgi_first_sid;
+    uint32_t cfgi_last_sid;
+    uint8_t  cfgi_pending;
+    uint8_t  cfgi_batch;
 } smmu_dev_t;
 
+/* Decoded event queue record. addr is the InputAddr of fault records and
+   is zero for events which do not carry one. */
+typedef struct {
+    uint32_t sid;
+    uint32_t ssid;
+    uint64_t addr;
+    uint8_t  id;
+    uint8_t  ssv;
+} smmu_event_record_t;
+
+/* Events seen per SMMU, StreamID and event ID, for val_smmu_event_count() */
+#define SMMU_EVT_HIST_SIZE 128
+
+typedef struct {
+    uint32_t smmu_index;
+    uint32_t sid;
+    uint32_t id;
+    uint32_t count;
+} smmu_event_hist_t;
+
 typedef enum {
     SMMU_STAGE_S1 = 0,
     SMMU_STAGE_S2,
@@ -161,9 +197,13 @@ typedef struct {
     uint32_t ssid_bits;
 } smmu_master_t;
 
-struct smmu_master_node {
+/* Masters are found through an open addressed hash of
+   (smmu index << 32 | StreamID), the table doubles at half load */
+#define SMMU_MASTER_MAP_MIN_SIZE 64
+
+typedef struct {
+    uint64_t key;
     smmu_master_t *master;
-    struct smmu_master_node *next;
-};
+} smmu_master_map_entry_t;
 
 #endif /*__SMMU_V3_H__ */
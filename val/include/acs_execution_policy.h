@@ -53,6 +53,36 @@ typedef struct acs_execution_policy {
      * not safely expose them. Compose with EL1SKIPTRAP_* flags.
      */
     uint32_t el1skiptrap_mask;
+    /*
+     * Shadow PCIe config space reads of read-only structural registers
+     * (capability list, header type, device/port type) per function.
+     */
+    bool     pcie_cfg_cache;
+    /*
+     * Probe the ECAM buses on all PEs while creating the PCIe BDF table,
+     * results are merged in the serial enumeration order.
+     */
+    bool     pcie_parallel_enum;
+    /*
+     * Run the PE-local rules on idle secondary PEs ahead of the suite,
+     * results are still reported in the rule list order.
+     */
+    bool     parallel_rules;
+    /*
+     * Allocate the memory of each test from a heap arena which is freed
+     * when the test reports its result (baremetal only).
+     */
+    bool     heap_test_arena;
+    /*
+     * Wake the secondary PEs of a multi-PE test in a tree, woken PEs wake
+     * further PEs while the primary PE runs its own payload.
+     */
+    bool     pe_fanout;
+    /*
+     * Park secondary PEs in WFE after their payload instead of powering
+     * them off, later payloads are posted to their mailbox.
+     */
+    bool     pe_worker_pool;
 } acs_execution_policy_t;
 
 void acs_reset_execution_policy(void);
@@ -69,5 +99,11 @@ uint32_t acs_policy_get_timer_timeout_us(void);
 uint32_t acs_policy_get_crypto_support(void);
 uint32_t acs_policy_get_sys_last_lvl_cache(void);
 uint32_t acs_policy_get_el1skiptrap_mask(void);
+bool acs_policy_get_pcie_cfg_cache(void);
+bool acs_policy_get_pcie_parallel_enum(void);
+bool acs_policy_get_parallel_rules(void);
+bool acs_policy_get_heap_test_arena(void);
+bool acs_policy_get_pe_fanout(void);
+bool acs_policy_get_pe_worker_pool(void);
 
 #endif /* __ACS_EXECUTION_POLICY_H__ */
@@ -40,6 +40,13 @@ void *val_memory_virt_to_phys(void *va);
 void *val_memory_phys_to_virt(uint64_t pa);
 void *val_memory_alloc_pages(uint32_t num_pages);
 void val_memory_free_pages(void *page_base, uint32_t num_pages);
+void val_memory_arena_open(void);
+void val_memory_arena_release(void);
+void val_memory_persist_begin(void);
+void val_memory_persist_end(void);
+uint32_t val_memory_scratch_reserve(uint32_t size);
+void *val_memory_scratch_alloc(uint32_t size);
+void val_memory_scratch_release(void);
 void *val_aligned_alloc(uint32_t alignment, uint32_t size);
 void val_memory_free_aligned(void *addr);
 void *val_memory_alloc_cacheable(uint32_t bdf, uint32_t size, void **pa);
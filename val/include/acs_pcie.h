@@ -42,6 +42,7 @@
 #define GET_DEVICE_ID(bus, dev, func) ((bus << 8) | (dev << 3) | func)
 
 #define PCIE_BUS_SHIFT 8
+#define PCIE_MAX_SEG   256
 #define PCIE_CFG_SIZE  4096
 
 #define PCIE_INTERRUPT_LINE      0x3c
@@ -81,7 +82,7 @@
 #define BAR_MASK           0xFFFFFFF0
 #define MSI_BIR_MASK       0xFFFFFFF8
 
-/* Allows storage of 2048 valid BDFs */
+/* Initial size of the BDF table (1023 BDFs), grows by doubling during enumeration */
 #define PCIE_DEVICE_BDF_TABLE_SZ 8192
 
 typedef enum {
@@ -161,9 +162,52 @@ typedef struct {
   pcie_device_attr device[];         ///< in the format of Segment/Bus/Dev/Func
 } pcie_device_bdf_table;
 
+/* Initial number of entries in the capability pool, grows by doubling */
+#define PCIE_CAP_POOL_INIT_SZ 1024
+/* Upper bound of a capability list walk, guards against malformed chains */
+#define PCIE_CAP_MAX_ENTRIES  (PCIE_CFG_SIZE / 4)
+
+typedef struct {
+  uint16_t id;           ///< Capability ID or Extended Capability ID
+  uint16_t offset;       ///< Offset of the capability structure in config space
+} pcie_cap_entry;
+
+typedef struct {
+  uint32_t start;        ///< First entry of the function in the capability pool
+  uint16_t num_cap;      ///< Number of PCI capabilities, stored first
+  uint16_t num_ecap;     ///< Number of PCIe extended capabilities, stored next
+  uint32_t ecap_status;  ///< Status returned when an ECAP is not in the list
+  uint32_t valid;        ///< Set once the function's capabilities are indexed
+} pcie_cap_index;
+
+/* Decoded attributes of the g_pcie_bdf_table functions, one array per attribute
+ * indexed by table index. Links hold (table index + 1) of an entry, 0 if none.
+ */
+typedef struct {
+  uint32_t *dp_type;      ///< Device/port type, as val_pcie_device_port_type
+  uint32_t *parent;       ///< Bridge whose secondary bus is this function's bus
+  uint32_t *next_on_bus;  ///< Next function on the same bus, in table order
+  uint16_t *ecam_index;   ///< ECAM index, PCIE_ECAM_INDEX_INVALID if none
+  uint8_t  *hdr_type;     ///< TYPE0_HEADER or TYPE1_HEADER
+  uint8_t  *sec_bus;      ///< Secondary bus number, Type 1 functions only
+  uint8_t  *sub_bus;      ///< Subordinate bus number, Type 1 functions only
+} pcie_bdf_attr_table;
+
+#define PCIE_ECAM_INDEX_INVALID 0xFFFF
+
+typedef struct {
+  uint32_t first;        ///< First function on this bus, in table order
+  uint32_t bridge;       ///< Bridge whose secondary bus is this bus
+  uint32_t rp;           ///< Root port whose bus range covers this bus
+} pcie_topology_bus;
+
 void     val_pcie_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data);
 void     val_pcie_io_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data);
 uint32_t val_pcie_read_cfg(uint32_t bdf, uint32_t offset, uint32_t *data);
+uint32_t val_pcie_read_cfg_cached(uint32_t bdf, uint32_t offset, uint32_t *data);
+void     val_pcie_cfg_cache_invalidate(uint32_t bdf);
+void     val_pcie_cfg_cache_invalidate_all(void);
+void     val_pcie_cfg_cache_get_stats(uint64_t *hits, uint64_t *misses);
 uint32_t val_get_msi_vectors(uint32_t bdf, PERIPHERAL_VECTOR_LIST **mvector);
 uint64_t val_pcie_get_bdf_config_addr(uint32_t bdf);
 
@@ -178,7 +222,18 @@ typedef enum {
   PCIE_INFO_SEGMENT
 }PCIE_INFO_e;
 
+typedef enum {
+  PCIE_BDF_INFO_BDF = 1,
+  PCIE_BDF_INFO_RP_BDF,
+  PCIE_BDF_INFO_DP_TYPE,
+  PCIE_BDF_INFO_HDR_TYPE,
+  PCIE_BDF_INFO_ECAM_INDEX,
+  PCIE_BDF_INFO_SEGMENT,
+  PCIE_BDF_INFO_BUS
+} PCIE_BDF_INFO_e;
+
 uint64_t val_pcie_get_info(PCIE_INFO_e type, uint32_t index);
+uint32_t val_pcie_get_bdf_info(PCIE_BDF_INFO_e type, uint32_t tbl_index);
 uint32_t val_pci_get_legacy_irq_map (uint32_t bdf, PERIPHERAL_IRQ_MAP *irq_map);
 uint32_t val_pcie_get_rootport(uint32_t bdf, uint32_t *rp_bdf);
 uint32_t val_pcie_get_device_type(uint32_t bdf);
@@ -189,6 +244,7 @@ uint32_t val_pcie_get_dma_coherent(uint32_t bdf);
 uint32_t val_pcie_io_read_cfg(uint32_t bdf, uint32_t offset, uint32_t *data);
 uint32_t val_pcie_populate_device_rootport(void);
 uint32_t val_pcie_get_ecam_index(uint32_t bdf, uint32_t *ecam_index);
+uint32_t val_pcie_get_bdf_table_index(uint32_t bdf, uint32_t *tbl_index);
 uint32_t val_pcie_data_link_layer_status(uint32_t bdf);
 uint32_t val_pcie_is_device_behind_smmu(uint32_t bdf);
 uint32_t val_pcie_check_interrupt_status(uint32_t bdf);
@@ -43,6 +43,11 @@
 #define PGT_DESC_ATTRIBUTES_MASK (PGT_DESC_ATTR_UPPER_MASK | PGT_DESC_ATTR_LOWER_MASK)
 #define PGT_DESC_ATTRIBUTES(val) (val & PGT_DESC_ATTRIBUTES_MASK)
 
+/* Contiguous hint, set on aligned runs of PGT_CONTIG_ENTRIES leaf entries
+   (4KB granule) which map contiguous output with identical attributes */
+#define PGT_DESC_CONTIG      (0x1ull << 52)
+#define PGT_CONTIG_ENTRIES   16
+
 #define PGT_STAGE1_AP_RO (0x3ull << 6)
 #define PGT_STAGE1_AP_RW (0x1ull << 6)
 #define PGT_STAGE2_AP_RO (0x1ull << 6)
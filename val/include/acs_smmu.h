@@ -39,12 +39,17 @@
 
 #define SMMUV3_ATS_BIT 10
 
+/* Wildcard for val_smmu_event_count() arguments */
+#define SMMU_EVT_ANY 0xFFFFFFFF
+
 /* PMCG CNTBaseN register offset*/
 #define SMMU_PMCG_CFGR 0xE00
 
 
 void val_smmu_unmap(smmu_master_attributes_t master);
 void val_smmu_dump_eventq(void);
+uint32_t val_smmu_event_count(uint32_t smmu_index, uint32_t sid, uint32_t event_id);
+void val_smmu_event_clear(void);
 void val_smmu_stop(void);
 
 uint64_t val_smmu_ssid_bits(uint32_t smmu_index);
@@ -57,6 +62,8 @@ uint64_t val_smmu_pa2iova(uint32_t smmu_index, uint64_t pa, uint64_t *dram_buf_i
 uint32_t val_smmu_init(void);
 uint64_t val_smmu_map(smmu_master_attributes_t master, pgt_descriptor_t pgt_desc);
 uint32_t val_smmu_config_ste_dcp(smmu_master_attributes_t master, uint32_t value);
+void val_smmu_batch_begin(uint32_t smmu_index);
+void val_smmu_batch_end(uint32_t smmu_index);
 
 uint32_t i001_entry(uint32_t num_pe);
 uint32_t i002_entry(uint32_t num_pe);
@@ -791,6 +791,7 @@ void     pal_print(uint64_t data);
 void     pal_uart_print(int log, const char *fmt, ...);
 void     pal_print_raw(uint64_t addr, char8_t *string, uint64_t data);
 void     pal_uart_putc(char c);
+void     pal_uart_write(const char *buf, uint32_t len);
 uint32_t pal_strncmp(char8_t *str1, char8_t *str2, uint32_t len);
 void     pal_mmu_add_mmap(void);
 void    *pal_mmu_get_mmap_list(void);
@@ -816,6 +817,10 @@ uint16_t pal_mmio_read16(uint64_t addr);
 uint32_t pal_mem_page_size(void);
 void    *pal_mem_alloc_pages(uint32_t num_pages);
 void     pal_mem_free_pages(void *page_base, uint32_t num_pages);
+void     pal_mem_arena_open(void);
+uint64_t pal_mem_arena_release(void);
+void     pal_mem_persist_begin(void);
+void     pal_mem_persist_end(void);
 void    *pal_aligned_alloc(uint32_t alignment, uint32_t size);
 void     pal_mem_free_aligned(void *buffer);
 void    *pal_mem_alloc_cacheable(uint32_t bdf, uint32_t size, void **pa);
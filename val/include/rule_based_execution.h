@@ -24,7 +24,6 @@
 #include "rule_based_execution_enum.h"
 
 #define RULE_STRING_SIZE 10
-#define RULE_DESC_SIZE   49
 #define INVALID_IDX 0xFFFFFFFF
 
 /* ----------------------------  Struct  Definations --------------------------------------------*/
@@ -32,14 +31,16 @@
 typedef uint32_t (*test_entry_fn_t)(uint32_t);
 typedef uint32_t (*module_init_entry_t)(uint32_t);
 
-/* Base rule id to test entry mapping structure definition*/
+/* Base rule id to test entry mapping structure definition. Kept compact since
+ * it is indexed for every rule run, descriptions live in rule_desc_string[].
+ */
 typedef struct {
-    TEST_ENTRY_ID_e  test_entry_id;
-    MODULE_NAME_e    module_id;     /* Module to which this test belongs */
-    RULE_FLAG_e      flag;
-    uint32_t         test_num;
+    uint16_t         test_entry_id; /* TEST_ENTRY_ID_e */
+    uint16_t         test_num;
+    uint16_t         alias_idx;     /* alias_rule_map index + 1, 0 if not an alias */
+    uint8_t          module_id;     /* MODULE_NAME_e, module to which this test belongs */
+    uint8_t          flag;          /* RULE_FLAG_e */
     char8_t          platform_bitmask;
-    char8_t          rule_desc[RULE_DESC_SIZE];
 } rule_test_map_t;
 
 /* Alias rules to Base rule mapping definition
@@ -82,9 +83,38 @@ typedef struct {
     PFDI_LEVEL_e level;
 } pfdi_rule_entry_t;
 
+/* Set of rule IDs, one bit per RULE_ID_e */
+#define RULE_SET_WORDS ((RULE_ID_SENTINEL + 31) / 32)
+
+typedef struct {
+    uint32_t word[RULE_SET_WORDS];
+} rule_set_t;
+
+static inline void rule_set_clear(rule_set_t *set)
+{
+    uint32_t i;
+
+    for (i = 0; i < RULE_SET_WORDS; i++)
+        set->word[i] = 0;
+}
+
+static inline void rule_set_add(rule_set_t *set, RULE_ID_e rid)
+{
+    if ((uint32_t)rid < RULE_ID_SENTINEL)
+        set->word[(uint32_t)rid / 32] |= (1u << ((uint32_t)rid % 32));
+}
+
+static inline bool rule_set_contains(const rule_set_t *set, RULE_ID_e rid)
+{
+    if ((uint32_t)rid >= RULE_ID_SENTINEL)
+        return 0;
+    return (set->word[(uint32_t)rid / 32] >> ((uint32_t)rid % 32)) & 1u;
+}
+
 /* ---------------------------- Helper functions declarations ---------------------------------- */
 void     quick_sort_rule_list(RULE_ID_e *rule_list, uint32_t list_size);
 uint32_t check_module_init(MODULE_NAME_e module_id);
+void     alias_rule_map_build_index(void);
 uint32_t alias_rule_map_get_index(RULE_ID_e alias_rule_id);
 void     print_rule_test_start(uint32_t rule_enum, uint32_t indent);
 void     print_rule_test_status(uint32_t rule_enum, uint32_t indent, uint32_t status);
@@ -94,6 +124,7 @@ void     print_pal_validation_info(uint32_t rule_enum, uint32_t indent);
 
 /* ---------------------------- Externs ---------------------------- */
 extern uint32_t rule_status_map[RULE_ID_SENTINEL];
+extern const char8_t *rule_desc_string[RULE_ID_SENTINEL];
 
 /* Rule lookup tables (defined in rule_lookup.c) */
 extern const bsa_rule_entry_t bsa_rule_list[];
@@ -92,8 +92,16 @@ typedef char char8_t;
 
 /* GENERIC VAL APIs */
 void val_allocate_shared_mem(void);
-uintptr_t val_get_status_region_base(void);
+uintptr_t val_get_status_slot(uint32_t index);
+volatile uint64_t *val_get_pending_count(void);
+volatile uint64_t *val_get_pending_bitmap(void);
 void val_free_shared_mem(void);
+uint32_t val_pe_pool_enabled(void);
+void val_pe_pool_park(void);
+uint32_t val_pe_pool_post(uint32_t index);
+void val_pe_pool_start_failed(uint32_t index);
+void val_pe_pool_drain(void);
+void val_pe_pool_set_legacy(uint32_t legacy);
 //void val_print(uint32_t level, char8_t *string, uint64_t data);
 void val_print_raw(uint64_t uart_addr, uint32_t level, char8_t *string, uint64_t data);
 void val_print_primary_pe(uint32_t level, char8_t *string, uint64_t data, uint32_t index);
@@ -123,7 +131,7 @@ typedef enum {
 void     val_pe_cache_clean_invalidate_range(uint64_t start_addr, uint64_t length);
 void     val_pe_cache_invalidate_range(uint64_t start_addr, uint64_t length);
 void     val_pe_free_info_table(void);
-void     val_execute_on_pe(uint32_t index, void (*payload)(void), uint64_t args);
+uint32_t val_execute_on_pe(uint32_t index, void (*payload)(void), uint64_t args);
 void     val_smbios_create_info_table(uint64_t *smbios_info_table);
 void     val_smbios_free_info_table(void);
 
@@ -470,6 +478,15 @@ typedef enum {
   MEM_TYPE_LAST_ENTRY
 } MEMORY_INFO_e;
 
+/* One region returned by val_memory_classify_range(), gaps in the memory
+   info table are reported as MEM_TYPE_NOT_POPULATED */
+typedef struct {
+  uint64_t base;
+  uint64_t size;
+  uint64_t type;
+  uint64_t flags;
+} MEMORY_RANGE_INFO;
+
 #define MEM_ATTR_UNCACHED  0x2000
 #define MEM_ATTR_CACHED    0x1000
 #define MEM_ALIGN_4K       0x1000
@@ -500,6 +517,8 @@ void val_setup_mair_register(void);
 void     val_memory_create_info_table(uint64_t *memory_info_table);
 void     val_memory_free_info_table(void);
 uint64_t val_memory_get_info(addr_t addr, uint64_t *attr);
+uint32_t val_memory_classify_range(addr_t base, uint64_t len, MEMORY_RANGE_INFO *ranges,
+                                   uint32_t max_ranges);
 uint32_t val_memory_get_entry_index(uint32_t type, uint32_t instance);
 uint32_t val_bsa_memory_execute_tests(uint32_t num_pe, uint32_t *g_sw_view);
 uint64_t val_memory_get_unpopulated_addr(addr_t *addr, uint32_t instance);
@@ -29,6 +29,13 @@ typedef enum {
 **/
 uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...);
 
+/**
+ *   @brief    - Serialises val_printf() across PEs while shared is true
+ *   @param    - shared  : true while more than one PE may print
+ *   @return   - None
+**/
+void val_log_set_shared(bool shared);
+
 void val_mem_copy(char *dest, const char *src, size_t len);
 
 #endif /* VAL_LOG_H */
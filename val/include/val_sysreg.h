@@ -354,6 +354,8 @@ SYSREG_RW_FUNCS(cptr_el3)
 SYSREG_RW_FUNCS(cpacr_el1)
 SYSREG_READ_FUNC(cntpct_el0)
 SYSREG_READ_FUNC(cntvct_el0)
+SYSREG_RW_FUNCS(cntkctl_el1)
+SYSREG_RW_FUNCS(cnthctl_el2)
 
 #define get_cntp_ctl_enable(x)  (((x) >> CNTP_CTL_ENABLE_SHIFT) & \
                     CNTP_CTL_ENABLE_MASK)
@@ -368,6 +370,8 @@ SYSREG_READ_FUNC(cntvct_el0)
 #define clr_cntp_ctl_enable(x)  ((x) &= ~(U(1) << CNTP_CTL_ENABLE_SHIFT))
 #define clr_cntp_ctl_imask(x)   ((x) &= ~(U(1) << CNTP_CTL_IMASK_SHIFT))
 
+SYSREG_RW_FUNCS(tpidr_el1)
+SYSREG_RW_FUNCS(tpidr_el2)
 SYSREG_RW_FUNCS(tpidr_el3)
 
 SYSREG_READ_FUNC(isr_el1)
@@ -97,3 +97,33 @@ uint32_t acs_policy_get_el1skiptrap_mask(void)
 {
     return g_execution_policy.el1skiptrap_mask;
 }
+
+bool acs_policy_get_pcie_cfg_cache(void)
+{
+    return g_execution_policy.pcie_cfg_cache;
+}
+
+bool acs_policy_get_pcie_parallel_enum(void)
+{
+    return g_execution_policy.pcie_parallel_enum;
+}
+
+bool acs_policy_get_parallel_rules(void)
+{
+    return g_execution_policy.parallel_rules;
+}
+
+bool acs_policy_get_heap_test_arena(void)
+{
+    return g_execution_policy.heap_test_arena;
+}
+
+bool acs_policy_get_pe_fanout(void)
+{
+    return g_execution_policy.pe_fanout;
+}
+
+bool acs_policy_get_pe_worker_pool(void)
+{
+    return g_execution_policy.pe_worker_pool;
+}
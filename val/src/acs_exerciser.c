@@ -145,6 +145,9 @@ uint32_t val_exerciser_set_param(EXERCISER_PARAM_TYPE type, uint64_t value1, uin
     status = pal_exerciser_set_param(type, value1, value2,
                                    g_exerciser_info_table.e_info[instance].bdf);
     val_mem_issue_dsb();
+
+    /* PAL may reprogram the exerciser config space directly */
+    val_pcie_cfg_cache_invalidate(g_exerciser_info_table.e_info[instance].bdf);
     return status;
 }
 
@@ -254,6 +257,7 @@ uint32_t val_exerciser_ops(EXERCISER_OPS ops, uint64_t param, uint32_t instance)
 
     status = pal_exerciser_ops(ops, param, g_exerciser_info_table.e_info[instance].bdf);
     val_mem_issue_dsb();
+    val_pcie_cfg_cache_invalidate(g_exerciser_info_table.e_info[instance].bdf);
     return status;
 }
 
@@ -19,11 +19,110 @@
 #include "acs_gic.h"
 #include "acs_gic_support.h"
 #include "acs_common.h"
+#include "acs_memory.h"
 #include "gic.h"
 #include "pal_interface.h"
 
 GIC_INFO_TABLE  *g_gic_info_table;
 
+/* Redistributor frames sorted by the affinity in their GICR_TYPER. Built by
+   val_gic_create_info_table() so that val_gic_get_pe_rdbase() does not
+   walk the redistributor regions. */
+typedef struct {
+  uint64_t affinity;
+  addr_t   base;
+} GIC_RD_INDEX_ENTRY;
+
+static GIC_RD_INDEX_ENTRY *g_gic_rd_index;
+static uint32_t g_gic_rd_index_count;
+
+/**
+  @brief   Visit every redistributor frame described by the GIC info table.
+           GICR structures are used when present, the GICC redistributor
+           bases otherwise.
+  @param   index - array to fill with up to max frames, or NULL to count them
+  @param   max   - number of entries in index
+  @return  Number of redistributor frames
+**/
+static uint32_t
+gic_rd_walk(GIC_RD_INDEX_ENTRY *index, uint32_t max)
+{
+  GIC_INFO_ENTRY  *gic_entry;
+  uint64_t        gicrd_granularity;
+  uint64_t        frame, frame_end;
+  uint32_t        use_gicc, count = 0;
+
+  gicrd_granularity = GICR_CTLR_FRAME_SIZE + GICR_SGI_PPI_FRAME_SIZE;
+
+  /* Redistributors in GICv4 define 2 additional 64KB frames - One each for VLPI and Reserved */
+  if (val_gic_get_info(GIC_INFO_VERSION) > 3)
+    gicrd_granularity += GICR_VLPI_FRAME_SIZE + GICR_RES_FRAME_SIZE;
+
+  use_gicc = (g_gic_info_table->header.num_gicr_rd == 0);
+
+  for (gic_entry = g_gic_info_table->gic_info; gic_entry->type != 0xFF; gic_entry++) {
+      /* A GICC redistributor entry without a length covers a single frame */
+      if (use_gicc && (gic_entry->type == ENTRY_TYPE_GICC_GICRD))
+          frame_end = gic_entry->base + (gic_entry->length ? gic_entry->length : 1);
+      else if (!use_gicc && (gic_entry->type == ENTRY_TYPE_GICR_GICRD))
+          frame_end = gic_entry->base + gic_entry->length;
+      else
+          continue;
+
+      for (frame = gic_entry->base; frame < frame_end; frame += gicrd_granularity) {
+          if ((index != NULL) && (count < max)) {
+              index[count].affinity = (val_mmio_read64(frame + GICR_TYPER) & GICR_TYPER_AFF) >> 32;
+              index[count].base = frame;
+          }
+          count++;
+      }
+  }
+
+  return count;
+}
+
+static void
+gic_free_rd_index(void)
+{
+  if (g_gic_rd_index != NULL)
+      val_memory_free(g_gic_rd_index);
+
+  g_gic_rd_index = NULL;
+  g_gic_rd_index_count = 0;
+}
+
+static void
+gic_build_rd_index(void)
+{
+  GIC_RD_INDEX_ENTRY  entry;
+  uint32_t            count, i, j;
+
+  gic_free_rd_index();
+
+  count = gic_rd_walk(NULL, 0);
+  if (count == 0)
+      return;
+
+  g_gic_rd_index = val_memory_calloc(count, sizeof(GIC_RD_INDEX_ENTRY));
+  if (g_gic_rd_index == NULL) {
+      val_print(WARN, "\n       GIC: could not allocate the redistributor index");
+      return;
+  }
+
+  count = gic_rd_walk(g_gic_rd_index, count);
+
+  /* Frames usually come in affinity order already, so insertion sort is linear */
+  for (i = 1; i < count; i++) {
+      entry = g_gic_rd_index[i];
+      for (j = i; (j > 0) && (g_gic_rd_index[j - 1].affinity > entry.affinity); j--)
+          g_gic_rd_index[j] = g_gic_rd_index[j - 1];
+      g_gic_rd_index[j] = entry;
+  }
+
+  g_gic_rd_index_count = count;
+  val_print(TRACE, " GIC_INFO: Redistributor frames indexed : %d\n", count);
+}
+
 /**
   @brief   This API will call PAL layer to fill in the GIC information
            into the g_gic_info_table pointer.
@@ -71,6 +170,10 @@ val_gic_create_info_table(uint64_t *gic_info_table)
       return ACS_STATUS_ERR;
   }
 
+  /* Resolve the version specific ops and redistributor frames once */
+  val_gic_select_ops(gic_version);
+  gic_build_rd_index();
+
   if (pal_target_is_dt())
       val_gic_init();
   if (pal_target_is_bm())
@@ -89,6 +192,8 @@ val_gic_create_info_table(uint64_t *gic_info_table)
 void
 val_gic_free_info_table(void)
 {
+    gic_free_rd_index();
+
     if (g_gic_info_table != NULL) {
         pal_mem_free_aligned((void *)g_gic_info_table);
         g_gic_info_table = NULL;
@@ -151,60 +256,32 @@ uint32_t val_get_num_nongic_ctrl(void)
 addr_t
 val_gic_get_pe_rdbase(uint64_t mpidr)
 {
-  uint32_t     gicrd_baselen;
-  uint32_t     gicr_rdindex = 0;
-  uint32_t     gic_version;
-  uint64_t     affinity, pe_affinity;
-  uint64_t     gicrd_granularity;
-  uint64_t     gicrd_base, pe_gicrd_base;
-
-  pe_affinity = (mpidr & (PE_AFF0 | PE_AFF1 | PE_AFF2)) | ((mpidr & PE_AFF3) >> 8);
-  gic_version = val_gic_get_info(GIC_INFO_VERSION);
-
-  gicrd_granularity = GICR_CTLR_FRAME_SIZE + GICR_SGI_PPI_FRAME_SIZE;
+  uint64_t     pe_affinity;
+  uint32_t     low, high, mid;
 
-  /* Redistributors in GICv4 define 2 additional 64KB frames - One each for VLPI and Reserved */
-  if (gic_version > 3)
-    gicrd_granularity += GICR_VLPI_FRAME_SIZE + GICR_RES_FRAME_SIZE;
-
-  gicr_rdindex = 0;
-
-  /* If System doesn't have GICR RD strcture, then use GICCC RD base */
-  if (g_gic_info_table->header.num_gicr_rd == 0) {
-      gicrd_base = val_get_gicr_base(&gicrd_baselen, 0);
-      val_print(DEBUG, "       gicrd_base 0x%lx\n", gicrd_base);
-
-      /* If information is present in GICC Structure */
-      if (gicrd_baselen == 0)
-      {
-          affinity = (val_mmio_read64(gicrd_base + GICR_TYPER) & GICR_TYPER_AFF) >> 32;
-          if (affinity == pe_affinity) {
-              return gicrd_base;
-          }
-          return 0;
-      }
+  if (g_gic_info_table == NULL) {
+      val_print(ERROR, "GIC INFO table not available\n");
+      return 0;
   }
 
-  /* Use GICR RD base structure */
-  while (gicr_rdindex < g_gic_info_table->header.num_gicr_rd) {
-      gicrd_base = val_get_gicr_base(&gicrd_baselen, gicr_rdindex);
-      val_print(TRACE, "       gicr_rdindex %d", gicr_rdindex);
-      val_print(TRACE, "       gicrd_base 0x%lx\n", gicrd_base);
+  if (g_gic_rd_index == NULL)
+      gic_build_rd_index();
 
-      pe_gicrd_base = gicrd_base;
-      while (pe_gicrd_base < (gicrd_base + gicrd_baselen))
-      {
-          val_print(TRACE, "       GICR_TYPER 0x%lx\n",
-                    val_mmio_read64(pe_gicrd_base + GICR_TYPER));
+  pe_affinity = (mpidr & (PE_AFF0 | PE_AFF1 | PE_AFF2)) | ((mpidr & PE_AFF3) >> 8);
 
-          affinity = (val_mmio_read64(pe_gicrd_base + GICR_TYPER) & GICR_TYPER_AFF) >> 32;
-          if (affinity == pe_affinity)
-              return pe_gicrd_base;
+  low = 0;
+  high = g_gic_rd_index_count;
+  while (low < high) {
+      mid = low + ((high - low) >> 1);
+      if (g_gic_rd_index[mid].affinity < pe_affinity)
+          low = mid + 1;
+      else
+          high = mid;
+  }
 
-          /* Move to the next GIC Redistributor frame */
-          pe_gicrd_base += gicrd_granularity;
-      }
-      gicr_rdindex++;
+  if ((low < g_gic_rd_index_count) && (g_gic_rd_index[low].affinity == pe_affinity)) {
+      val_print(TRACE, "       gicrd_base 0x%lx\n", g_gic_rd_index[low].base);
+      return g_gic_rd_index[low].base;
   }
 
   return 0;
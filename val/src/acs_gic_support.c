@@ -282,6 +282,7 @@ its_fail:
   val_print(DEBUG, "  ITS Init failed: ");
   val_print(DEBUG, "LPI Interrupt related test may not pass\n");
   val_memory_free_aligned((void *)g_gic_its_info);
+  g_gic_its_info = NULL;
 
   return ACS_STATUS_ERR;
 }
@@ -473,6 +474,9 @@ void val_gic_free_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
   uint32_t its_index;
   uint32_t msi_cap_offset;
 
+  if ((g_gic_its_info == NULL) || (g_gic_its_info->GicNumIts == 0))
+    return;
+
   its_index = get_its_index(its_id);
   if (its_index >= g_gic_its_info->GicNumIts)
   {
@@ -486,7 +490,8 @@ void val_gic_free_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
     return;
   }
 
-  val_its_clear_lpi_map(its_index, device_id, int_id);
+  if (val_its_clear_lpi_map(its_index, device_id, int_id))
+    val_print(ERROR, "\n       Could not clear LPI [%x] mapping", int_id);
   /* Get MSI-X/MSI Capability Offset */
   if (!(val_pcie_find_capability(bdf, PCIE_CAP, CID_MSIX, &msi_cap_offset)))
     clear_msi_x_table(bdf, msi_index, msi_cap_offset);
@@ -530,7 +535,10 @@ uint32_t val_gic_request_msi(uint32_t bdf, uint32_t device_id, uint32_t its_id,
     return ACS_STATUS_ERR;
   }
 
-  val_its_create_lpi_map(its_index, device_id, int_id, LPI_PRIORITY1);
+  if (val_its_create_lpi_map(its_index, device_id, int_id, LPI_PRIORITY1)) {
+    val_print(ERROR, "\n       Could not map LPI [%x]", int_id);
+    return ACS_STATUS_ERR;
+  }
 
   msi_addr = val_its_get_translater_addr(its_index);
   msi_data = int_id-ARM_LPI_MINID;
@@ -185,6 +185,8 @@ int64_t val_drtm_features(uint64_t fid, uint64_t *feat1, uint64_t *feat2)
  */
 int64_t val_drtm_dynamic_launch(DRTM_PARAMETERS *drtm_params)
 {
+    /* Secondary PEs must be off, including those parked in the worker pool */
+    val_pe_pool_drain();
     return val_drtm_simulate_dl(drtm_params);
 }
 
@@ -33,6 +33,33 @@ extern IOREMMAP_LIST *ioremmap_list;
 
 #define CHECK_ADDR_52BIT(addr) (((uint64_t)(addr)) & ~ADDR_52BIT_MASK)
 
+/* Scratch regions and their slots are cache line aligned so no two PEs
+   write to the same line */
+#define SCRATCH_ALIGN  64
+
+typedef struct {
+    uint64_t cur;
+    uint64_t end;
+    uint8_t  pad[SCRATCH_ALIGN - 2 * sizeof(uint64_t)];
+} SCRATCH_SLOT;
+
+static SCRATCH_SLOT *g_scratch_slot;
+static void        *g_scratch_base;
+static uint32_t     g_scratch_num_pe;
+
+/* Sorted, non-overlapping view of g_memory_info_table. Where table entries
+   overlap, the earliest entry owns the overlap as it would in a linear scan.
+   Neighbouring intervals of the same type and flags are merged. */
+typedef struct {
+    uint64_t base;
+    uint64_t end;
+    uint64_t type;
+    uint64_t flags;
+} MEM_INTERVAL;
+
+static MEM_INTERVAL *g_mem_interval;
+static uint32_t      g_mem_num_interval;
+
 
 #ifdef TARGET_BAREMETAL
 /**
@@ -67,6 +94,129 @@ uint32_t val_mmu_get_mapping_count(void)
 #endif  // TARGET_BAREMETAL
 
 #ifndef TARGET_LINUX
+/**
+  @brief  Sort an array of 64-bit keys in ascending order
+
+  @param  key  Keys to sort
+  @param  num  Number of keys
+
+  @return None
+**/
+static void
+val_memory_sort_keys(uint64_t *key, uint32_t num)
+{
+  uint32_t gap, i, j;
+  uint64_t tmp;
+
+  /* Shell sort, the table is sorted once at creation time */
+  for (gap = num / 2; gap > 0; gap /= 2) {
+      for (i = gap; i < num; i++) {
+          tmp = key[i];
+          for (j = i; (j >= gap) && (key[j - gap] > tmp); j -= gap)
+              key[j] = key[j - gap];
+          key[j] = tmp;
+      }
+  }
+}
+
+/**
+  @brief  Append an interval to g_mem_interval, merging it with the previous
+          one when they touch and share type and flags
+
+  @param  base   Start of the interval
+  @param  end    End of the interval, exclusive
+  @param  entry  Memory info table entry which owns the interval
+
+  @return None
+**/
+static void
+val_memory_add_interval(uint64_t base, uint64_t end, MEM_INFO_BLOCK *entry)
+{
+  MEM_INTERVAL *last;
+
+  if (g_mem_num_interval) {
+      last = &g_mem_interval[g_mem_num_interval - 1];
+      if ((last->end == base) && (last->type == entry->type) &&
+          (last->flags == entry->flags)) {
+          last->end = end;
+          return;
+      }
+  }
+
+  g_mem_interval[g_mem_num_interval].base  = base;
+  g_mem_interval[g_mem_num_interval].end   = end;
+  g_mem_interval[g_mem_num_interval].type  = entry->type;
+  g_mem_interval[g_mem_num_interval].flags = entry->flags;
+  g_mem_num_interval++;
+}
+
+/**
+  @brief  Build the sorted interval index of g_memory_info_table used by
+          val_memory_get_info() and val_memory_classify_range()
+
+  @param  None
+
+  @return None, lookups scan the table if the index could not be built
+**/
+static void
+val_memory_build_interval_index(void)
+{
+  MEM_INFO_BLOCK *info = g_memory_info_table->info;
+  uint64_t *point;
+  uint64_t end;
+  uint32_t num = 0, num_point = 0, i, j;
+
+  while (info[num].type != MEMORY_TYPE_LAST_ENTRY)
+      num++;
+
+  if (num == 0)
+      return;
+
+  /* Every interval edge is a start or an end of some entry, so at most
+     2 * num - 1 intervals are produced */
+  point = val_memory_calloc(2 * num, sizeof(uint64_t));
+  g_mem_interval = val_memory_calloc(2 * num, sizeof(MEM_INTERVAL));
+  if ((point == NULL) || (g_mem_interval == NULL)) {
+      val_print(WARN, "\n WARNING: No memory for memory info index, using table scan");
+      if (point)
+          val_memory_free(point);
+      if (g_mem_interval)
+          val_memory_free(g_mem_interval);
+      g_mem_interval = NULL;
+      return;
+  }
+
+  for (i = 0; i < num; i++) {
+      if (info[i].size == 0)
+          continue;
+      point[num_point++] = info[i].phy_addr;
+      point[num_point++] = info[i].phy_addr + info[i].size;
+  }
+
+  val_memory_sort_keys(point, num_point);
+
+  /* Each elementary segment between two edges belongs to the first entry
+     covering it */
+  g_mem_num_interval = 0;
+  for (i = 0; i + 1 < num_point; i++) {
+      if (point[i] == point[i + 1])
+          continue;
+
+      for (j = 0; j < num; j++) {
+          end = info[j].phy_addr + info[j].size;
+          if ((info[j].phy_addr <= point[i]) && (point[i] < end))
+              break;
+      }
+
+      if (j < num)
+          val_memory_add_interval(point[i], point[i + 1], &info[j]);
+  }
+
+  val_memory_free(point);
+  val_print(TRACE, " MEMORY_INFO: %d entries indexed", num);
+  val_print(TRACE, " as %d intervals\n", g_mem_num_interval);
+}
+
 /**
   @brief  Free the memory allocated for the Memory Info table
 
@@ -77,6 +227,12 @@ uint32_t val_mmu_get_mapping_count(void)
 void
 val_memory_free_info_table(void)
 {
+    if (g_mem_interval != NULL) {
+        val_memory_free(g_mem_interval);
+        g_mem_interval = NULL;
+        g_mem_num_interval = 0;
+    }
+
     if (g_memory_info_table != NULL) {
         pal_mem_free((void *)g_memory_info_table);
         g_memory_info_table = NULL;
@@ -106,6 +262,7 @@ val_memory_create_info_table(uint64_t *memory_info_table)
 
   pal_memory_create_info_table(g_memory_info_table);
 
+  val_memory_build_interval_index();
 }
 #endif
 
@@ -137,6 +294,28 @@ val_memory_get_entry_index(uint32_t type, uint32_t instance)
   return 0xFF;
 }
 
+/**
+  @brief   Binary search the interval index
+  @param   addr - Address to look up
+  @return  Number of intervals starting at or below addr, the interval which
+           may contain addr is the one before this position
+**/
+static uint32_t
+val_memory_find_interval(addr_t addr)
+{
+  uint32_t lo = 0, hi = g_mem_num_interval, mid;
+
+  while (lo < hi) {
+      mid = lo + (hi - lo) / 2;
+      if (g_mem_interval[mid].base <= addr)
+          lo = mid + 1;
+      else
+          hi = mid;
+  }
+
+  return lo;
+}
+
 /**
   @brief   Returns the type and attributes of a given memory address
            1. Caller       - Test Suite
@@ -151,6 +330,17 @@ val_memory_get_info(addr_t addr, uint64_t *attr)
 {
 
   uint32_t index = 0;
+  uint32_t lo;
+
+  if (g_mem_interval != NULL) {
+      lo = val_memory_find_interval(addr);
+      if (lo && (addr < g_mem_interval[lo - 1].end)) {
+          *attr = g_mem_interval[lo - 1].flags;
+          return g_mem_interval[lo - 1].type;
+      }
+
+      return MEM_TYPE_NOT_POPULATED;
+  }
 
   while (g_memory_info_table->info[index].type != MEMORY_TYPE_LAST_ENTRY) {
       if ((addr >= g_memory_info_table->info[index].phy_addr) &&
@@ -167,6 +357,91 @@ val_memory_get_info(addr_t addr, uint64_t *attr)
 
 }
 
+/**
+  @brief   Returns the regions of the memory info table overlapping a range
+           1. Caller       - Test Suite
+           2. Prerequisite - val_memory_create_info_table
+  @param   base        - Start of the range
+  @param   len         - Length of the range in bytes
+  @param   ranges      - Filled with the regions in address order, clipped to
+                         the range. Gaps are reported as MEM_TYPE_NOT_POPULATED.
+  @param   max_ranges  - Number of entries ranges can hold
+
+  @return  Number of regions covering the range, which may be more than
+           max_ranges when the array was too small
+**/
+uint32_t
+val_memory_classify_range(addr_t base, uint64_t len, MEMORY_RANGE_INFO *ranges,
+                          uint32_t max_ranges)
+{
+  uint64_t addr = base;
+  uint64_t end = base + len;
+  uint64_t next, type, attr = 0;
+  uint64_t last_type = 0, last_attr = 0;
+  uint32_t count = 0;
+  uint32_t lo;
+
+  if ((len == 0) || (end < base))
+      return 0;
+
+  /* Without the index, classify by probing each table entry boundary */
+  while (addr < end) {
+      next = end;
+
+      if (g_mem_interval != NULL) {
+          lo = val_memory_find_interval(addr);
+          if (lo && (addr < g_mem_interval[lo - 1].end)) {
+              type = g_mem_interval[lo - 1].type;
+              attr = g_mem_interval[lo - 1].flags;
+              if (g_mem_interval[lo - 1].end < next)
+                  next = g_mem_interval[lo - 1].end;
+          } else {
+              type = MEM_TYPE_NOT_POPULATED;
+              attr = 0;
+              if ((lo < g_mem_num_interval) && (g_mem_interval[lo].base < next))
+                  next = g_mem_interval[lo].base;
+          }
+      } else {
+          uint32_t index = 0;
+
+          type = val_memory_get_info(addr, &attr);
+          if (type == MEM_TYPE_NOT_POPULATED)
+              attr = 0;
+
+          /* The run ends at the nearest entry edge above addr */
+          while (g_memory_info_table->info[index].type != MEMORY_TYPE_LAST_ENTRY) {
+              MEM_INFO_BLOCK *entry = &g_memory_info_table->info[index];
+
+              if ((entry->phy_addr > addr) && (entry->phy_addr < next))
+                  next = entry->phy_addr;
+              if ((entry->phy_addr + entry->size > addr) &&
+                  (entry->phy_addr + entry->size < next))
+                  next = entry->phy_addr + entry->size;
+              index++;
+          }
+      }
+
+      if (count && (last_type == type) && (last_attr == attr)) {
+          if ((ranges != NULL) && (count <= max_ranges))
+              ranges[count - 1].size += next - addr;
+      } else {
+          if ((ranges != NULL) && (count < max_ranges)) {
+              ranges[count].base  = addr;
+              ranges[count].size  = next - addr;
+              ranges[count].type  = type;
+              ranges[count].flags = attr;
+          }
+          count++;
+          last_type = type;
+          last_attr = attr;
+      }
+
+      addr = next;
+  }
+
+  return count;
+}
+
 /**
   @brief   Maps the physical memory to virtual address space
            1. Caller       - Test Suite
@@ -372,6 +647,154 @@ val_memory_free_pages(void *addr, uint32_t num_pages)
     pal_mem_free_pages(addr, num_pages);
 }
 
+/**
+  @brief  Open a heap arena, memory allocated from now on is freed by
+          val_memory_arena_release(). Only the baremetal heap has arenas.
+
+  @return None
+**/
+void
+val_memory_arena_open(void)
+{
+#ifdef TARGET_BAREMETAL
+    pal_mem_arena_open();
+#endif
+}
+
+/**
+  @brief  Free all memory allocated since val_memory_arena_open().
+
+  @return None
+**/
+void
+val_memory_arena_release(void)
+{
+#ifdef TARGET_BAREMETAL
+    pal_mem_arena_release();
+#endif
+}
+
+/**
+  @brief  Start allocations which are kept across tests. Memory allocated
+          until val_memory_persist_end() is not owned by an open arena, so it
+          can be created on first use inside a test and reused by later ones.
+          Calls nest.
+
+  @return None
+**/
+void
+val_memory_persist_begin(void)
+{
+#ifdef TARGET_BAREMETAL
+    pal_mem_persist_begin();
+#endif
+}
+
+/**
+  @brief  End allocations started by val_memory_persist_begin().
+
+  @return None
+**/
+void
+val_memory_persist_end(void)
+{
+#ifdef TARGET_BAREMETAL
+    pal_mem_persist_end();
+#endif
+}
+
+/**
+  @brief  Reserve a scratch region of the given size for every PE. Called by
+          the primary PE before a multi-PE payload is started, the payload
+          then takes memory with val_memory_scratch_alloc() without touching
+          the shared heap. A previous reservation is released first.
+
+  @param  size  Bytes reserved for each PE.
+
+  @return ACS_STATUS_PASS on success, ACS_STATUS_ERR if memory is not available.
+**/
+uint32_t
+val_memory_scratch_reserve(uint32_t size)
+{
+  uint32_t num_pe = val_pe_get_num();
+  uint64_t region;
+  uint32_t index;
+
+  val_memory_scratch_release();
+
+  size = (size + SCRATCH_ALIGN - 1) & ~(SCRATCH_ALIGN - 1);
+  if (num_pe == 0 || size == 0)
+      return ACS_STATUS_ERR;
+
+  g_scratch_slot = val_aligned_alloc(SCRATCH_ALIGN, num_pe * sizeof(SCRATCH_SLOT));
+  g_scratch_base = val_aligned_alloc(SCRATCH_ALIGN, num_pe * size);
+  if (g_scratch_slot == NULL || g_scratch_base == NULL) {
+      val_print(ERROR, "\n       Scratch reservation of 0x%x bytes per PE failed", size);
+      val_memory_scratch_release();
+      return ACS_STATUS_ERR;
+  }
+
+  region = (uint64_t)g_scratch_base;
+  for (index = 0; index < num_pe; index++) {
+      g_scratch_slot[index].cur = region;
+      g_scratch_slot[index].end = region + size;
+      region += size;
+      val_data_cache_ops_by_va((addr_t)&g_scratch_slot[index], CLEAN_AND_INVALIDATE);
+  }
+
+  g_scratch_num_pe = num_pe;
+  return ACS_STATUS_PASS;
+}
+
+/**
+  @brief  Allocate from the scratch region of the running PE. Each PE only
+          moves its own slot, so no lock is taken. The memory is returned by
+          val_memory_scratch_release().
+
+  @param  size  Requested size in bytes.
+
+  @return Address aligned to 16 bytes, NULL when the region is exhausted.
+**/
+void *
+val_memory_scratch_alloc(uint32_t size)
+{
+  uint32_t index;
+  uint64_t addr;
+
+  if (g_scratch_slot == NULL)
+      return NULL;
+
+  index = val_pe_get_index_mpid(val_pe_get_mpid());
+  if (index >= g_scratch_num_pe)
+      return NULL;
+
+  addr = (g_scratch_slot[index].cur + 15) & ~0xFull;
+  if (addr + size > g_scratch_slot[index].end)
+      return NULL;
+
+  g_scratch_slot[index].cur = addr + size;
+  return (void *)addr;
+}
+
+/**
+  @brief  Free the scratch regions of all PEs. Called by the primary PE once
+          the payload has completed on every PE.
+
+  @return None
+**/
+void
+val_memory_scratch_release(void)
+{
+  if (g_scratch_slot)
+      val_memory_free_aligned(g_scratch_slot);
+  if (g_scratch_base)
+      val_memory_free_aligned(g_scratch_base);
+
+  g_scratch_slot = NULL;
+  g_scratch_base = NULL;
+  g_scratch_num_pe = 0;
+}
+
 /**
   @brief  Allocates memory with the given alignment.
 
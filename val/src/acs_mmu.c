@@ -152,14 +152,15 @@ uint32_t
 val_mmu_add_entry(uint64_t base_addr, uint64_t size, uint64_t attr)
 {
   pgt_descriptor_t pgt_desc;
-  memory_region_descriptor_t mem_desc;
+  memory_region_descriptor_t mem_desc_array[2], *mem_desc;
   uint64_t ttbr;
   uint8_t mair_val;
   uint32_t status = 0;
   const uint32_t oas_bit_arr[7] = {32, 36, 40, 42, 44, 48, 52}; /* Physical address sizes */
 
   /* init descriptors */
-  val_memory_set(&mem_desc, sizeof(mem_desc), 0);
+  val_memory_set(mem_desc_array, sizeof(mem_desc_array), 0);
+  mem_desc = &mem_desc_array[0];
   val_memory_set(&pgt_desc, sizeof(pgt_desc), 0);
   pgt_desc.stage = PGT_STAGE1;
 
@@ -185,18 +186,18 @@ val_mmu_add_entry(uint64_t base_addr, uint64_t size, uint64_t attr)
   val_print(DEBUG, "\n   Output addr size in bits (oas) = %d\n", pgt_desc.oas);
 
   /* populate mem descriptor structure with addr region to be mapped and attributes */
-  mem_desc.virtual_address = base_addr;
-  mem_desc.physical_address = base_addr;
-  mem_desc.length = size;
+  mem_desc->virtual_address = base_addr;
+  mem_desc->physical_address = base_addr;
+  mem_desc->length = size;
   status = val_get_attr_index(attr, &mair_val);
   if (status)
     return status;
 
-  mem_desc.attributes = (mair_val << MEM_ATTR_INDX_SHIFT)
-                        | (1ull << MEM_ATTR_AF_SHIFT);
+  mem_desc->attributes = (mair_val << MEM_ATTR_INDX_SHIFT)
+                         | (1ull << MEM_ATTR_AF_SHIFT);
 
   /* update translation table entry(s) for addr region defined by memory descriptor structure  */
-  if (val_pgt_create(&mem_desc, &pgt_desc)) {
+  if (val_pgt_create(mem_desc, &pgt_desc)) {
       val_print(ERROR, "   Failed to create MMU translation entry(s)\n");
       return 1;
   }
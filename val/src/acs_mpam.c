@@ -1935,6 +1935,7 @@ void val_mem_free_shared_memcpybuf(uint32_t num_pe)
   }
 
   val_memory_free(g_shared_memcpy_buffer);
+  g_shared_memcpy_buffer = NULL;
 }
 
 /**
@@ -2251,7 +2252,10 @@ val_mpam_msc_request_msi(uint32_t msc_index, uint32_t device_id, uint32_t its_id
         return ACS_STATUS_ERR;
     }
 
-    val_its_create_lpi_map(its_index, device_id, int_id, LPI_PRIORITY1);
+    if (val_its_create_lpi_map(its_index, device_id, int_id, LPI_PRIORITY1)) {
+        val_print(ERROR, "\n       Could not map LPI [%x]", int_id);
+        return ACS_STATUS_ERR;
+    }
 
     msi_addr = val_its_get_translater_addr(its_index);
     msi_data = int_id - ARM_LPI_MINID;
@@ -28,11 +28,397 @@
 pcie_bdf_list_t *pcie_pheripherals_bdf_list = NULL;
 PCIE_INFO_TABLE *g_pcie_info_table;
 pcie_device_bdf_table *g_pcie_bdf_table;
+static uint32_t g_pcie_bdf_table_capacity;
+
+/* Size in bytes of a BDF table holding num entries */
+#define PCIE_BDF_TABLE_BYTES(num) (sizeof(pcie_device_bdf_table) + \
+                                   ((num) * sizeof(pcie_device_attr)))
 
 uint32_t pcie_bdf_table_list_flag;
 uint32_t g_pcie_integrated_devices;
 uint64_t pal_get_mcfg_ptr(void);
 
+/* Segment/Bus to ECAM index lookup, built once from g_pcie_info_table.
+ * g_pcie_ecam_seg_slot[seg] holds (slot + 1) of the segment's bus map, and
+ * g_pcie_ecam_bus_map[slot * PCIE_MAX_BUS + bus] holds (ecam index + 1).
+ * A zero value in either table means the segment/bus is not ECAM mapped.
+ */
+static uint16_t g_pcie_ecam_seg_slot[PCIE_MAX_SEG];
+static uint16_t *g_pcie_ecam_bus_map;
+static uint32_t g_pcie_ecam_num_slots;
+
+/* Hash of a BDF, used by the per-function lookup tables below */
+#define PCIE_BDF_HASH_BUCKETS  256
+#define PCIE_BDF_HASH(bdf) ((PCIE_EXTRACT_BDF_SEG(bdf) ^ PCIE_EXTRACT_BDF_BUS(bdf) ^ \
+                            (PCIE_EXTRACT_BDF_DEV(bdf) << 3) ^ \
+                            PCIE_EXTRACT_BDF_FUNC(bdf)) & (PCIE_BDF_HASH_BUCKETS - 1))
+
+/* Config space shadow of one function, filled lazily one dword at a time */
+#define PCIE_CFG_SHADOW_DWORDS   (PCIE_CFG_SIZE / 4)
+
+typedef struct pcie_cfg_shadow {
+  struct pcie_cfg_shadow *next;
+  uint32_t bdf;
+  uint32_t valid[PCIE_CFG_SHADOW_DWORDS / 32];
+  uint32_t data[PCIE_CFG_SHADOW_DWORDS];
+} pcie_cfg_shadow_t;
+
+static pcie_cfg_shadow_t *g_pcie_cfg_shadow[PCIE_BDF_HASH_BUCKETS];
+static uint64_t g_pcie_cfg_cache_hits;
+static uint64_t g_pcie_cfg_cache_misses;
+
+/* BDF to g_pcie_bdf_table index lookup, values are (table index + 1), 0 ends a chain */
+static uint32_t g_pcie_bdf_hash[PCIE_BDF_HASH_BUCKETS];
+static uint32_t *g_pcie_bdf_hash_next;
+
+/* Capability offsets of every function in g_pcie_bdf_table, indexed by table index */
+static pcie_cap_index *g_pcie_cap_index;
+static pcie_cap_entry *g_pcie_cap_pool;
+static uint32_t g_pcie_cap_pool_used;
+static uint32_t g_pcie_cap_pool_size;
+
+/* Decoded attributes and PCIe hierarchy of g_pcie_bdf_table, snapshot of the bus
+ * numbers at enumeration. g_pcie_bdf_attr arrays are indexed by table index,
+ * g_pcie_topology_bus by (segment slot * PCIE_MAX_BUS + bus) using the ECAM
+ * segment slots.
+ */
+static pcie_bdf_attr_table g_pcie_bdf_attr;
+static pcie_topology_bus *g_pcie_topology_bus;
+
+/* Functions of a bus that responded to a probe, one bit per (dev * PCIE_MAX_FUNC + func) */
+#define PCIE_ENUM_BUS_WORDS     ((PCIE_MAX_DEV * PCIE_MAX_FUNC) / 32)
+/* Partitions start on a multiple of this many buses, so no two PEs share a cache line */
+#define PCIE_ENUM_BUS_ALIGN     8
+#define PCIE_ENUM_PART_PENDING  0xFFFFFFFF
+#define PCIE_ENUM_PART_ABORTED  0xFFFFFFFE
+
+/* A range of buses of one ECAM, probed by a single PE during parallel enumeration */
+typedef struct {
+  uint32_t seg;
+  uint32_t start_bus;
+  uint32_t end_bus;
+  uint32_t worker;          ///< Worker which probes this partition, 0 is the primary PE
+  uint32_t *bus_map;        ///< PCIE_ENUM_BUS_WORDS words per bus, from start_bus
+  uint32_t status;          ///< PCIE_ENUM_PART_PENDING until the worker is done
+                            ///< PCIE_ENUM_PART_ABORTED if it stopped after a timeout
+  uint32_t err_bdf;         ///< Function whose probe could not be mapped
+} pcie_enum_part_t;
+
+static pcie_enum_part_t *g_pcie_enum_part;
+static uint32_t g_pcie_enum_num_part;
+static uint32_t *g_pcie_enum_bus_map;
+static uint32_t g_pcie_enum_abort;
+
+/**
+  @brief   Builds the Segment/Bus to ECAM index lookup table from g_pcie_info_table
+           so that config space accessors resolve the ECAM base in constant time.
+           1. Caller       -  val_pcie_create_info_table
+           2. Prerequisite -  pal_pcie_create_info_table
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_create_ecam_map(void)
+{
+  uint32_t num_ecam;
+  uint32_t num_slots = 0;
+  uint32_t ecam_index;
+  uint32_t seg;
+  uint32_t bus;
+  uint32_t start_bus;
+  uint32_t end_bus;
+  uint16_t *bus_map;
+
+  if (g_pcie_ecam_bus_map != NULL) {
+      val_memory_free(g_pcie_ecam_bus_map);
+      g_pcie_ecam_bus_map = NULL;
+  }
+
+  val_memory_set(g_pcie_ecam_seg_slot, sizeof(g_pcie_ecam_seg_slot), 0);
+  g_pcie_ecam_num_slots = 0;
+
+  num_ecam = g_pcie_info_table->num_entries;
+
+  /* Assign one bus map slot per distinct segment */
+  for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
+  {
+      seg = g_pcie_info_table->block[ecam_index].segment_num;
+      if (seg >= PCIE_MAX_SEG) {
+          val_print(ERROR, "\n       Invalid ECAM segment %x", seg);
+          continue;
+      }
+
+      if (g_pcie_ecam_seg_slot[seg] == 0)
+          g_pcie_ecam_seg_slot[seg] = ++num_slots;
+  }
+
+  g_pcie_ecam_num_slots = num_slots;
+  if (num_slots == 0)
+      return;
+
+  g_pcie_ecam_bus_map = val_memory_calloc(num_slots * PCIE_MAX_BUS, sizeof(uint16_t));
+  if (g_pcie_ecam_bus_map == NULL) {
+      val_print(WARN, "\n       ECAM lookup table allocation failed, using linear search");
+      return;
+  }
+
+  for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
+  {
+      seg = g_pcie_info_table->block[ecam_index].segment_num;
+      if (seg >= PCIE_MAX_SEG)
+          continue;
+
+      start_bus = g_pcie_info_table->block[ecam_index].start_bus_num;
+      end_bus = g_pcie_info_table->block[ecam_index].end_bus_num;
+      if (end_bus >= PCIE_MAX_BUS)
+          end_bus = PCIE_MAX_BUS - 1;
+
+      bus_map = &g_pcie_ecam_bus_map[(g_pcie_ecam_seg_slot[seg] - 1) * PCIE_MAX_BUS];
+
+      /* First matching ECAM wins, same as the linear search order */
+      for (bus = start_bus; bus <= end_bus; bus++)
+      {
+          if (bus_map[bus] == 0)
+              bus_map[bus] = ecam_index + 1;
+      }
+  }
+}
+
+/**
+  @brief   Returns the ECAM base covering the input segment and bus.
+           1. Caller       -  PCIe config space accessors
+           2. Prerequisite -  val_pcie_create_info_table
+  @param   segment - PCIe segment number
+  @param   bus     - PCIe bus number
+
+  @return  ECAM base address, 0 if segment/bus is not ECAM mapped
+**/
+static addr_t
+val_pcie_ecam_base_lookup(uint32_t segment, uint32_t bus)
+{
+  uint32_t slot;
+  uint32_t ecam_index;
+
+  if (g_pcie_ecam_bus_map != NULL) {
+      if (segment >= PCIE_MAX_SEG)
+          return 0;
+
+      slot = g_pcie_ecam_seg_slot[segment];
+      if (slot == 0)
+          return 0;
+
+      ecam_index = g_pcie_ecam_bus_map[(slot - 1) * PCIE_MAX_BUS + bus];
+      if (ecam_index == 0)
+          return 0;
+
+      return g_pcie_info_table->block[ecam_index - 1].ecam_base;
+  }
+
+  /* Lookup table not available, walk all the ECAM blocks */
+  for (ecam_index = 0; ecam_index < g_pcie_info_table->num_entries; ecam_index++)
+  {
+      if ((bus >= g_pcie_info_table->block[ecam_index].start_bus_num) &&
+          (bus <= g_pcie_info_table->block[ecam_index].end_bus_num) &&
+          (segment == g_pcie_info_table->block[ecam_index].segment_num))
+          return g_pcie_info_table->block[ecam_index].ecam_base;
+  }
+
+  return 0;
+}
+
+/**
+  @brief   Returns the config space shadow of the input function, NULL if
+           none was created yet.
+  @param   bdf    - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+
+  @return  Pointer to the function's shadow or NULL
+**/
+static pcie_cfg_shadow_t *
+val_pcie_cfg_shadow_find(uint32_t bdf)
+{
+  pcie_cfg_shadow_t *shadow;
+
+  shadow = g_pcie_cfg_shadow[PCIE_BDF_HASH(bdf)];
+  while (shadow != NULL)
+  {
+      if (shadow->bdf == bdf)
+          return shadow;
+      shadow = shadow->next;
+  }
+
+  return NULL;
+}
+
+/**
+  @brief   Drops the shadowed copy of the config space dword at the input offset,
+           so that the next cached read observes the value in hardware.
+  @param   bdf    - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+  @param   offset - Register offset within the function config space
+
+  @return  None
+**/
+static void
+val_pcie_cfg_shadow_drop(uint32_t bdf, uint32_t offset)
+{
+  pcie_cfg_shadow_t *shadow;
+  uint32_t dword;
+
+  if (offset >= PCIE_CFG_SIZE)
+      return;
+
+  shadow = val_pcie_cfg_shadow_find(bdf);
+  if (shadow == NULL)
+      return;
+
+  dword = offset >> 2;
+  shadow->valid[dword / 32] &= ~(1u << (dword % 32));
+}
+
+/**
+  @brief   Reads 32-bit data from PCIe config space through the per-function shadow.
+           Only meant for read-only/HwInit registers (capability headers, header
+           type, device/port type), as RW registers may change behind the shadow.
+           Falls back to val_pcie_read_cfg when the shadow is disabled by policy.
+           1. Caller       -  Validation layer, Test Suite
+           2. Prerequisite -  val_pcie_create_info_table
+  @param   bdf    - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+  @param   offset - Register offset within a device PCIe config space
+  @param   *data  - 32-bit data read from the config space
+
+  @return  success/failure
+**/
+uint32_t
+val_pcie_read_cfg_cached(uint32_t bdf, uint32_t offset, uint32_t *data)
+{
+  pcie_cfg_shadow_t *shadow;
+  uint32_t dword;
+  uint32_t status;
+
+  if (!acs_policy_get_pcie_cfg_cache() || (offset >= PCIE_CFG_SIZE) ||
+      (offset & WORD_ALIGN_MASK))
+      return val_pcie_read_cfg(bdf, offset, data);
+
+  dword = offset >> 2;
+  shadow = val_pcie_cfg_shadow_find(bdf);
+  if ((shadow != NULL) && (shadow->valid[dword / 32] & (1u << (dword % 32)))) {
+      g_pcie_cfg_cache_hits++;
+      *data = shadow->data[dword];
+      return 0;
+  }
+
+  g_pcie_cfg_cache_misses++;
+  status = val_pcie_read_cfg(bdf, offset, data);
+
+  /* Do not shadow failed accesses or absent functions */
+  if (status || (*data == PCIE_UNKNOWN_RESPONSE))
+      return status;
+
+  /* Shadows are kept across tests, so they are not owned by a test arena */
+  if (shadow == NULL) {
+      val_memory_persist_begin();
+      shadow = val_memory_calloc(1, sizeof(pcie_cfg_shadow_t));
+      val_memory_persist_end();
+      if (shadow == NULL)
+          return 0;
+
+      shadow->bdf = bdf;
+      shadow->next = g_pcie_cfg_shadow[PCIE_BDF_HASH(bdf)];
+      g_pcie_cfg_shadow[PCIE_BDF_HASH(bdf)] = shadow;
+  }
+
+  shadow->data[dword] = *data;
+  shadow->valid[dword / 32] |= (1u << (dword % 32));
+  return 0;
+}
+
+/**
+  @brief   Invalidates the config space shadow of the input function. Tests that
+           modify config space without val_pcie_write_cfg (PAL or direct MMIO
+           writes, resets) must call this before relying on cached reads.
+  @param   bdf    - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+
+  @return  None
+**/
+void
+val_pcie_cfg_cache_invalidate(uint32_t bdf)
+{
+  pcie_cfg_shadow_t *shadow;
+
+  shadow = val_pcie_cfg_shadow_find(bdf);
+  if (shadow != NULL)
+      val_memory_set(shadow->valid, sizeof(shadow->valid), 0);
+}
+
+/**
+  @brief   Invalidates the config space shadow of all functions.
+  @param   None
+
+  @return  None
+**/
+void
+val_pcie_cfg_cache_invalidate_all(void)
+{
+  pcie_cfg_shadow_t *shadow;
+  uint32_t bucket;
+
+  for (bucket = 0; bucket < PCIE_BDF_HASH_BUCKETS; bucket++)
+  {
+      for (shadow = g_pcie_cfg_shadow[bucket]; shadow != NULL; shadow = shadow->next)
+          val_memory_set(shadow->valid, sizeof(shadow->valid), 0);
+  }
+}
+
+/**
+  @brief   Returns the config space shadow hit and miss counters.
+  @param   *hits   - Number of reads served from the shadow
+  @param   *misses - Number of reads that went to ECAM
+
+  @return  None
+**/
+void
+val_pcie_cfg_cache_get_stats(uint64_t *hits, uint64_t *misses)
+{
+  if (hits != NULL)
+      *hits = g_pcie_cfg_cache_hits;
+  if (misses != NULL)
+      *misses = g_pcie_cfg_cache_misses;
+}
+
+/**
+  @brief   Releases the config space shadow of all functions.
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_cfg_cache_free(void)
+{
+  pcie_cfg_shadow_t *shadow;
+  pcie_cfg_shadow_t *next;
+  uint32_t bucket;
+
+  if (acs_policy_get_pcie_cfg_cache()) {
+      val_print(DEBUG, "\n PCIE_INFO: Config cache hits %lld", g_pcie_cfg_cache_hits);
+      val_print(DEBUG, ", misses %lld\n", g_pcie_cfg_cache_misses);
+  }
+
+  for (bucket = 0; bucket < PCIE_BDF_HASH_BUCKETS; bucket++)
+  {
+      shadow = g_pcie_cfg_shadow[bucket];
+      while (shadow != NULL)
+      {
+          next = shadow->next;
+          val_memory_free(shadow);
+          shadow = next;
+      }
+      g_pcie_cfg_shadow[bucket] = NULL;
+  }
+
+  g_pcie_cfg_cache_hits = 0;
+  g_pcie_cfg_cache_misses = 0;
+}
+
 /**
   @brief   This API reads 32-bit data from PCIe config space pointed by Bus,
            Device, Function and register offset.
@@ -52,8 +438,7 @@ val_pcie_read_cfg(uint32_t bdf, uint32_t offset, uint32_t *data)
   uint32_t func    = PCIE_EXTRACT_BDF_FUNC(bdf);
   uint32_t segment = PCIE_EXTRACT_BDF_SEG(bdf);
   uint32_t cfg_addr;
-  addr_t   ecam_base = 0;
-  uint32_t i = 0;
+  addr_t   ecam_base;
 
   if ((bus >= PCIE_MAX_BUS) || (dev >= PCIE_MAX_DEV) || (func >= PCIE_MAX_FUNC)) {
      val_print(ERROR, "\n       Invalid Bus/Dev/Func  %x", bdf);
@@ -65,17 +450,7 @@ val_pcie_read_cfg(uint32_t bdf, uint32_t offset, uint32_t *data)
       return PCIE_NO_MAPPING;
   }
 
-  while (i < (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0))
-  {
-
-      if ((bus >= (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, i)) &&
-           (bus <= (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, i)) &&
-           (segment == (uint32_t)val_pcie_get_info(PCIE_INFO_SEGMENT, i))) {
-          ecam_base = val_pcie_get_info(PCIE_INFO_ECAM, i);
-          break;
-      }
-      i++;
-  }
+  ecam_base = val_pcie_ecam_base_lookup(segment, bus);
 
   if (ecam_base == 0) {
       val_print(ERROR, "\n       PCIe_CFG_RD ECAM Base is zero %.8x", bdf);
@@ -127,8 +502,7 @@ val_pcie_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data)
   uint32_t func     = PCIE_EXTRACT_BDF_FUNC(bdf);
   uint32_t segment  = PCIE_EXTRACT_BDF_SEG(bdf);
   uint32_t cfg_addr;
-  addr_t   ecam_base = 0;
-  uint32_t i = 0;
+  addr_t   ecam_base;
 
 
   if ((bus >= PCIE_MAX_BUS) || (dev >= PCIE_MAX_DEV) || (func >= PCIE_MAX_FUNC)) {
@@ -141,17 +515,7 @@ val_pcie_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data)
       return;
   }
 
-  while (i < (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0))
-  {
-
-      if ((bus >= (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, i)) &&
-           (bus <= (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, i)) &&
-           (segment == (uint32_t)val_pcie_get_info(PCIE_INFO_SEGMENT, i))) {
-          ecam_base = val_pcie_get_info(PCIE_INFO_ECAM, i);
-          break;
-      }
-      i++;
-  }
+  ecam_base = val_pcie_ecam_base_lookup(segment, bus);
 
   if (ecam_base == 0) {
       val_print(ERROR, "\n       PCIe_CFG_WR ECAM Base is zero %.8x", bdf);
@@ -164,6 +528,9 @@ val_pcie_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data)
 
   pal_mmio_write(ecam_base + cfg_addr + offset, data);
   val_mem_issue_dsb();
+
+  /* Write-through, the next cached read of this dword refetches from hardware */
+  val_pcie_cfg_shadow_drop(bdf, offset);
 }
 
 /**
@@ -182,6 +549,7 @@ val_pcie_io_write_cfg(uint32_t bdf, uint32_t offset, uint32_t data)
 {
     pal_pcie_io_write_cfg(bdf, offset, data);
     val_mem_issue_dsb();
+    val_pcie_cfg_shadow_drop(bdf, offset);
     return;
 }
 
@@ -234,9 +602,7 @@ uint64_t val_pcie_get_bdf_config_addr(uint32_t bdf)
   uint32_t func     = PCIE_EXTRACT_BDF_FUNC(bdf);
   uint32_t segment  = PCIE_EXTRACT_BDF_SEG(bdf);
   uint32_t cfg_addr;
-  uint32_t num_ecam;
-  addr_t   ecam_base = 0;
-  uint32_t i = 0;
+  addr_t   ecam_base;
 
   if ((bus >= PCIE_MAX_BUS) || (dev >= PCIE_MAX_DEV) || (func >= PCIE_MAX_FUNC)) {
      val_print(ERROR, "\n       Invalid Bus/Dev/Func  %x", bdf);
@@ -248,18 +614,7 @@ uint64_t val_pcie_get_bdf_config_addr(uint32_t bdf)
       return 0;
   }
 
-  num_ecam = (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0);
-  while (i < num_ecam)
-  {
-
-      if ((bus >= (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, i)) &&
-           (bus <= (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, i)) &&
-           (segment == (uint32_t)val_pcie_get_info(PCIE_INFO_SEGMENT, i))) {
-          ecam_base = val_pcie_get_info(PCIE_INFO_ECAM, i);
-          break;
-      }
-      i++;
-  }
+  ecam_base = val_pcie_ecam_base_lookup(segment, bus);
 
   if (ecam_base == 0) {
       val_print(ERROR, "\n       BDF config Read PCIe_CFG: ECAM Base is zero %x", bdf);
@@ -405,108 +760,1052 @@ val_pcie_print_device_info(void)
           dev_num  = PCIE_EXTRACT_BDF_DEV(bdf);
           func_num = PCIE_EXTRACT_BDF_FUNC(bdf);
 
-          val_pcie_read_cfg(bdf, TYPE01_VIDR, &reg_value);
-          device_id = (reg_value >> TYPE01_DIDR_SHIFT) & TYPE01_DIDR_MASK;
-          vendor_id = (reg_value >> TYPE01_VIDR_SHIFT) & TYPE01_VIDR_MASK;
+          val_pcie_read_cfg(bdf, TYPE01_VIDR, &reg_value);
+          device_id = (reg_value >> TYPE01_DIDR_SHIFT) & TYPE01_DIDR_MASK;
+          vendor_id = (reg_value >> TYPE01_VIDR_SHIFT) & TYPE01_VIDR_MASK;
+
+          dev_ecam_base = val_pcie_get_ecam_base(bdf);
+
+          if ((ecam_base == dev_ecam_base) && (bus_num >= ecam_start_bus)
+              && (bus_num <= ecam_end_bus))
+          {
+              bdf_counter = 1;
+              bdf = PCIE_CREATE_BDF(seg_num, bus_num, dev_num, func_num);
+              val_print(TRACE, "  BDF: 0x%x\n", bdf);
+              val_print(TRACE, "  Seg: 0x%x, ", seg_num);
+              val_print(TRACE, "Bus: 0x%02x, ", bus_num);
+              val_print(TRACE, "Dev: 0x%02x, ", dev_num);
+              val_print(TRACE, "Func: 0x%x, ", func_num);
+              val_print(TRACE, "Dev ID: 0x%04x, ", device_id);
+              val_print(TRACE, "Vendor ID: 0x%04x\n", vendor_id);
+          }
+      }
+      if (bdf_counter == 0)
+          val_print(TRACE, "  No BDF devices in ECAM region index %d\n", ecam_index);
+
+      ecam_index++;
+  }
+}
+
+/**
+  @brief   This API will call PAL layer to fill in the PCIe information
+           into the g_pcie_info_table pointer.
+           1. Caller       -  Application layer.
+           2. Prerequisite -  Memory allocated and passed as argument.
+  @param   pcie_info_table    Memory address where PCIe Information is populated
+
+  @return  Error if Input param is NULL
+**/
+void
+val_pcie_create_info_table(uint64_t *pcie_info_table)
+{
+  uint32_t num_ecam;
+
+  if (pcie_info_table == NULL) {
+      val_print(ERROR, "Input for Create Info table cannot be NULL\n");
+      return;
+  }
+  val_print(TRACE, " Creating PCIe INFO table\n");
+
+  g_pcie_info_table = (PCIE_INFO_TABLE *)pcie_info_table;
+
+  pal_pcie_create_info_table(g_pcie_info_table);
+
+  /* Build Segment/Bus to ECAM lookup used by the config space accessors */
+  val_pcie_create_ecam_map();
+
+  num_ecam = (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0);
+  val_print(INFO, " PCIE_INFO: Number of ECAM regions    :    %ld\n", num_ecam);
+  if (num_ecam == 0)
+      return;
+
+  val_pcie_enumerate();
+
+  /* Create the list of valid Pcie Device Functions */
+  if (val_pcie_create_device_bdf_table()) {
+      val_print(ERROR, "   Create Bdf table failed.\n");
+      return;
+  }
+
+  if (pal_pcie_check_device_list()) {
+    pcie_bdf_table_list_flag = 1;
+    val_print(ERROR, "Pcie device list doesn't match \
+                with platform pcie device hierarchy\n");
+  }
+
+  val_pcie_print_device_info();
+}
+
+/**
+  @brief  Sanity checks that all Endpoints must have a Rootport
+
+  @param  None
+  @return 0 if sanity check passes, 1 if sanity check fails
+**/
+uint32_t val_pcie_populate_device_rootport(void)
+{
+  uint32_t bdf;
+  uint32_t rp_bdf;
+  uint32_t tbl_index;
+  pcie_device_bdf_table *bdf_tbl_ptr;
+
+  bdf_tbl_ptr = val_pcie_bdf_table_ptr();
+  tbl_index = 0;
+
+  for (tbl_index = 0; tbl_index < bdf_tbl_ptr->num_entries; tbl_index++)
+  {
+      bdf = bdf_tbl_ptr->device[tbl_index].bdf;
+      val_print(DEBUG, "  Dev bdf 0x%06x", bdf);
+
+      /* Checks if the BDF has RootPort */
+      val_pcie_get_rootport(bdf, &rp_bdf);
+
+      bdf_tbl_ptr->device[tbl_index].rp_bdf = rp_bdf;
+      val_print(DEBUG, " RP bdf 0x%06x\n", rp_bdf);
+  }
+  return 0;
+}
+
+/**
+  @brief   Returns the index of the input function in the BDF table.
+           1. Caller       -  Validation layer, Test Suite
+           2. Prerequisite -  val_pcie_create_device_bdf_table
+  @param   bdf        - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+  @param   *tbl_index - On return, index of the function in g_pcie_bdf_table
+
+  @return  0 if the function is in the table, 1 otherwise
+**/
+uint32_t
+val_pcie_get_bdf_table_index(uint32_t bdf, uint32_t *tbl_index)
+{
+  uint32_t entry;
+
+  if ((g_pcie_bdf_table == NULL) || (g_pcie_bdf_hash_next == NULL))
+      return 1;
+
+  entry = g_pcie_bdf_hash[PCIE_BDF_HASH(bdf)];
+  while (entry != 0)
+  {
+      if (g_pcie_bdf_table->device[entry - 1].bdf == bdf) {
+          *tbl_index = entry - 1;
+          return 0;
+      }
+      entry = g_pcie_bdf_hash_next[entry - 1];
+  }
+
+  return 1;
+}
+
+/**
+  @brief   Appends a capability to the capability pool, growing it when full.
+  @param   id     - Capability ID or Extended Capability ID
+  @param   offset - Offset of the capability structure in config space
+
+  @return  0 if Success, 1 if the pool could not be grown
+**/
+static uint32_t
+val_pcie_cap_pool_add(uint32_t id, uint32_t offset)
+{
+  pcie_cap_entry *pool;
+  uint32_t size;
+
+  if (g_pcie_cap_pool_used == g_pcie_cap_pool_size)
+  {
+      size = (g_pcie_cap_pool_size) ? (g_pcie_cap_pool_size * 2) : PCIE_CAP_POOL_INIT_SZ;
+      pool = val_memory_alloc(size * sizeof(pcie_cap_entry));
+      if (pool == NULL)
+          return 1;
+
+      if (g_pcie_cap_pool != NULL) {
+          val_memcpy(pool, g_pcie_cap_pool, g_pcie_cap_pool_used * sizeof(pcie_cap_entry));
+          val_memory_free(g_pcie_cap_pool);
+      }
+
+      g_pcie_cap_pool = pool;
+      g_pcie_cap_pool_size = size;
+  }
+
+  g_pcie_cap_pool[g_pcie_cap_pool_used].id = id;
+  g_pcie_cap_pool[g_pcie_cap_pool_used].offset = offset;
+  g_pcie_cap_pool_used++;
+  return 0;
+}
+
+/**
+  @brief   Frees the BDF lookup and capability index of the BDF table.
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_free_bdf_index(void)
+{
+  if (g_pcie_bdf_hash_next != NULL) {
+      val_memory_free(g_pcie_bdf_hash_next);
+      g_pcie_bdf_hash_next = NULL;
+  }
+
+  if (g_pcie_cap_index != NULL) {
+      val_memory_free(g_pcie_cap_index);
+      g_pcie_cap_index = NULL;
+  }
+
+  if (g_pcie_cap_pool != NULL) {
+      val_memory_free(g_pcie_cap_pool);
+      g_pcie_cap_pool = NULL;
+  }
+
+  g_pcie_cap_pool_used = 0;
+  g_pcie_cap_pool_size = 0;
+}
+
+/**
+  @brief   Builds the BDF lookup and records every capability and extended
+           capability offset of each function in the BDF table, in one walk of
+           the capability lists. val_pcie_find_capability answers from it.
+           1. Caller       -  val_pcie_create_device_bdf_table
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_create_bdf_index(void)
+{
+  uint32_t tbl_index;
+  uint32_t bucket;
+  uint32_t bdf;
+  uint32_t reg_value;
+  uint32_t next_cap_offset;
+  uint32_t num_entries;
+  pcie_cap_index *cap_idx;
+
+  val_pcie_free_bdf_index();
+  val_memory_set(g_pcie_bdf_hash, sizeof(g_pcie_bdf_hash), 0);
+
+  num_entries = g_pcie_bdf_table->num_entries;
+  if (num_entries == 0)
+      return;
+
+  g_pcie_bdf_hash_next = val_memory_calloc(num_entries, sizeof(uint32_t));
+  g_pcie_cap_index = val_memory_calloc(num_entries, sizeof(pcie_cap_index));
+  if ((g_pcie_bdf_hash_next == NULL) || (g_pcie_cap_index == NULL)) {
+      val_print(WARN, "\n       PCIe BDF index allocation failed");
+      val_pcie_free_bdf_index();
+      return;
+  }
+
+  /* Insert in reverse so that each chain is in table order */
+  for (tbl_index = num_entries; tbl_index > 0; tbl_index--)
+  {
+      bucket = PCIE_BDF_HASH(g_pcie_bdf_table->device[tbl_index - 1].bdf);
+      g_pcie_bdf_hash_next[tbl_index - 1] = g_pcie_bdf_hash[bucket];
+      g_pcie_bdf_hash[bucket] = tbl_index;
+  }
+
+  for (tbl_index = 0; tbl_index < num_entries; tbl_index++)
+  {
+      bdf = g_pcie_bdf_table->device[tbl_index].bdf;
+      cap_idx = &g_pcie_cap_index[tbl_index];
+      cap_idx->start = g_pcie_cap_pool_used;
+      cap_idx->ecap_status = PCIE_CAP_NOT_FOUND;
+
+      /* PCI capability list, bounded in case of a malformed chain */
+      val_pcie_read_cfg_cached(bdf, TYPE01_CPR, &reg_value);
+      next_cap_offset = (reg_value & TYPE01_CPR_MASK);
+      while (next_cap_offset && (cap_idx->num_cap < PCIE_CAP_MAX_ENTRIES))
+      {
+          val_pcie_read_cfg_cached(bdf, next_cap_offset, &reg_value);
+          if (val_pcie_cap_pool_add(reg_value & PCIE_CIDR_MASK, next_cap_offset))
+              goto index_fail;
+          cap_idx->num_cap++;
+          next_cap_offset = ((reg_value >> PCIE_NCPR_SHIFT) & PCIE_NCPR_MASK);
+      }
+
+      /* PCIe extended capability list */
+      next_cap_offset = PCIE_ECAP_START;
+      while (next_cap_offset && (cap_idx->num_ecap < PCIE_CAP_MAX_ENTRIES))
+      {
+          val_pcie_read_cfg_cached(bdf, next_cap_offset, &reg_value);
+          if (reg_value == PCIE_UNKNOWN_RESPONSE) {
+              cap_idx->ecap_status = PCIE_UNKNOWN_RESPONSE;
+              break;
+          }
+          if (val_pcie_cap_pool_add(reg_value & PCIE_ECAP_CIDR_MASK, next_cap_offset))
+              goto index_fail;
+          cap_idx->num_ecap++;
+          next_cap_offset = ((reg_value >> PCIE_ECAP_NCPR_SHIFT) & PCIE_ECAP_NCPR_MASK);
+      }
+
+      cap_idx->valid = 1;
+  }
+
+  val_print(DEBUG, " PCIE_INFO: Capability entries indexed:    %d\n", g_pcie_cap_pool_used);
+  return;
+
+index_fail:
+  /* Keep the BDF lookup, functions without a valid index walk config space */
+  val_print(WARN, "\n       PCIe capability index allocation failed");
+  val_memory_set(g_pcie_cap_index, num_entries * sizeof(pcie_cap_index), 0);
+}
+
+/**
+  @brief   Returns the topology bus node of the input segment and bus.
+  @param   seg   - PCIe segment number
+  @param   bus   - PCIe bus number
+
+  @return  Pointer to the bus node, NULL if the segment has no ECAM
+**/
+static pcie_topology_bus *
+val_pcie_topology_get_bus(uint32_t seg, uint32_t bus)
+{
+  uint32_t slot;
+
+  if ((g_pcie_topology_bus == NULL) || (seg >= PCIE_MAX_SEG) || (bus >= PCIE_MAX_BUS))
+      return NULL;
+
+  slot = g_pcie_ecam_seg_slot[seg];
+  if (slot == 0)
+      return NULL;
+
+  return &g_pcie_topology_bus[(slot - 1) * PCIE_MAX_BUS + bus];
+}
+
+/**
+  @brief   Frees the decoded attributes and PCIe topology of the BDF table.
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_free_topology(void)
+{
+  /* All attribute arrays share the allocation made for dp_type */
+  if (g_pcie_bdf_attr.dp_type != NULL) {
+      val_memory_free(g_pcie_bdf_attr.dp_type);
+      val_memory_set(&g_pcie_bdf_attr, sizeof(g_pcie_bdf_attr), 0);
+  }
+
+  if (g_pcie_topology_bus != NULL) {
+      val_memory_free(g_pcie_topology_bus);
+      g_pcie_topology_bus = NULL;
+  }
+}
+
+/**
+  @brief   Builds the decoded attributes and PCIe topology of the BDF table: the
+           port and header type, ECAM index and bus range of every function, the
+           functions on each bus, the bridge whose secondary bus is each bus and
+           the root port covering each bus. Attribute and hierarchy queries are
+           answered from it without config reads.
+           1. Caller       -  val_pcie_create_device_bdf_table
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_create_topology(void)
+{
+  uint32_t tbl_index;
+  uint32_t num_entries;
+  uint32_t bdf;
+  uint32_t bus;
+  uint32_t reg_value;
+  uint32_t ecam_index;
+  uint8_t *attr_mem;
+  pcie_bdf_attr_table attr;
+  pcie_topology_bus *bus_node;
+
+  val_pcie_free_topology();
+
+  num_entries = g_pcie_bdf_table->num_entries;
+  if ((num_entries == 0) || (g_pcie_ecam_num_slots == 0))
+      return;
+
+  /* One allocation carved into per-attribute arrays, widest first to keep alignment */
+  attr_mem = val_memory_calloc(num_entries, (3 * sizeof(uint32_t)) + sizeof(uint16_t) +
+                                            (3 * sizeof(uint8_t)));
+  g_pcie_topology_bus = val_memory_calloc(g_pcie_ecam_num_slots * PCIE_MAX_BUS,
+                                          sizeof(pcie_topology_bus));
+  if ((attr_mem == NULL) || (g_pcie_topology_bus == NULL)) {
+      val_print(WARN, "\n       PCIe topology allocation failed");
+      if (attr_mem != NULL)
+          val_memory_free(attr_mem);
+      val_pcie_free_topology();
+      return;
+  }
+
+  attr.dp_type     = (uint32_t *)attr_mem;
+  attr.parent      = attr.dp_type + num_entries;
+  attr.next_on_bus = attr.parent + num_entries;
+  attr.ecam_index  = (uint16_t *)(attr.next_on_bus + num_entries);
+  attr.hdr_type    = (uint8_t *)(attr.ecam_index + num_entries);
+  attr.sec_bus     = attr.hdr_type + num_entries;
+  attr.sub_bus     = attr.sec_bus + num_entries;
+
+  /* Decode each function once */
+  for (tbl_index = 0; tbl_index < num_entries; tbl_index++)
+  {
+      bdf = g_pcie_bdf_table->device[tbl_index].bdf;
+      attr.dp_type[tbl_index] = val_pcie_device_port_type(bdf);
+      attr.hdr_type[tbl_index] = val_pcie_function_header_type(bdf);
+
+      if (attr.hdr_type[tbl_index] == TYPE1_HEADER) {
+          val_pcie_read_cfg(bdf, TYPE1_PBN, &reg_value);
+          attr.sec_bus[tbl_index] = ((reg_value >> SECBN_SHIFT) & SECBN_MASK);
+          attr.sub_bus[tbl_index] = ((reg_value >> SUBBN_SHIFT) & SUBBN_MASK);
+      }
+
+      if (val_pcie_get_ecam_index(bdf, &ecam_index))
+          attr.ecam_index[tbl_index] = PCIE_ECAM_INDEX_INVALID;
+      else
+          attr.ecam_index[tbl_index] = ecam_index;
+  }
+
+  /* Chain the functions of each bus, in table order */
+  for (tbl_index = num_entries; tbl_index > 0; tbl_index--)
+  {
+      bdf = g_pcie_bdf_table->device[tbl_index - 1].bdf;
+      bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(bdf), PCIE_EXTRACT_BDF_BUS(bdf));
+      if (bus_node == NULL)
+          continue;
+
+      attr.next_on_bus[tbl_index - 1] = bus_node->first;
+      bus_node->first = tbl_index;
+  }
+
+  /* Link each bus to its upstream bridge and covering root port, first in table order.
+     Bridges left unconfigured by firmware have secondary bus 0 and own no bus. */
+  for (tbl_index = 0; tbl_index < num_entries; tbl_index++)
+  {
+      if ((attr.hdr_type[tbl_index] != TYPE1_HEADER) || (attr.sec_bus[tbl_index] == 0))
+          continue;
+
+      bdf = g_pcie_bdf_table->device[tbl_index].bdf;
+      bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(bdf), attr.sec_bus[tbl_index]);
+      if ((bus_node != NULL) && (bus_node->bridge == 0))
+          bus_node->bridge = tbl_index + 1;
+
+      if ((attr.dp_type[tbl_index] != RP) && (attr.dp_type[tbl_index] != iEP_RP))
+          continue;
+
+      for (bus = attr.sec_bus[tbl_index]; bus <= attr.sub_bus[tbl_index]; bus++)
+      {
+          bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(bdf), bus);
+          if ((bus_node != NULL) && (bus_node->rp == 0))
+              bus_node->rp = tbl_index + 1;
+      }
+  }
+
+  /* Parent links */
+  for (tbl_index = 0; tbl_index < num_entries; tbl_index++)
+  {
+      bdf = g_pcie_bdf_table->device[tbl_index].bdf;
+      bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(bdf), PCIE_EXTRACT_BDF_BUS(bdf));
+      if (bus_node != NULL)
+          attr.parent[tbl_index] = bus_node->bridge;
+  }
+
+  /* Publish only once filled, the attribute accessors answer from it when set */
+  g_pcie_bdf_attr = attr;
+}
+
+/**
+  @brief   Returns the index of the input function in the decoded attribute arrays.
+  @param   bdf        - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+  @param   tbl_index  - Table index of the function
+
+  @return  0 on success, 1 if the attributes of the function are not available
+**/
+static uint32_t
+val_pcie_bdf_attr_index(uint32_t bdf, uint32_t *tbl_index)
+{
+  if (g_pcie_bdf_attr.dp_type == NULL)
+      return 1;
+
+  return val_pcie_get_bdf_table_index(bdf, tbl_index);
+}
+
+/**
+  @brief   This API returns a decoded attribute of a g_pcie_bdf_table entry.
+           1. Caller       -  Test Suite
+           2. Prerequisite -  val_pcie_create_device_bdf_table
+  @param   type       - Attribute to be returned
+  @param   tbl_index  - Index of the function in g_pcie_bdf_table
+
+  @return  Attribute value, 0 if the index or attribute is invalid.
+           PCIE_BDF_INFO_ECAM_INDEX returns PCIE_ECAM_INDEX_INVALID if the
+           function has no ECAM.
+**/
+uint32_t
+val_pcie_get_bdf_info(PCIE_BDF_INFO_e type, uint32_t tbl_index)
+{
+  uint32_t bdf;
+  uint32_t ecam_index;
+
+  if ((g_pcie_bdf_table == NULL) || (tbl_index >= g_pcie_bdf_table->num_entries)) {
+      val_print(ERROR, "GET_PCIe_BDF_INFO: Invalid table index %d\n", tbl_index);
+      return 0;
+  }
+
+  bdf = g_pcie_bdf_table->device[tbl_index].bdf;
+
+  switch (type) {
+  case PCIE_BDF_INFO_BDF:
+      return bdf;
+  case PCIE_BDF_INFO_RP_BDF:
+      return g_pcie_bdf_table->device[tbl_index].rp_bdf;
+  case PCIE_BDF_INFO_SEGMENT:
+      return PCIE_EXTRACT_BDF_SEG(bdf);
+  case PCIE_BDF_INFO_BUS:
+      return PCIE_EXTRACT_BDF_BUS(bdf);
+  default:
+      break;
+  }
+
+  /* Decoded attributes, read from config space if the topology is not built */
+  if (g_pcie_bdf_attr.dp_type != NULL) {
+      switch (type) {
+      case PCIE_BDF_INFO_DP_TYPE:
+          return g_pcie_bdf_attr.dp_type[tbl_index];
+      case PCIE_BDF_INFO_HDR_TYPE:
+          return g_pcie_bdf_attr.hdr_type[tbl_index];
+      case PCIE_BDF_INFO_ECAM_INDEX:
+          return g_pcie_bdf_attr.ecam_index[tbl_index];
+      default:
+          break;
+      }
+  } else {
+      switch (type) {
+      case PCIE_BDF_INFO_DP_TYPE:
+          return val_pcie_device_port_type(bdf);
+      case PCIE_BDF_INFO_HDR_TYPE:
+          return val_pcie_function_header_type(bdf);
+      case PCIE_BDF_INFO_ECAM_INDEX:
+          if (val_pcie_get_ecam_index(bdf, &ecam_index))
+              return PCIE_ECAM_INDEX_INVALID;
+          return ecam_index;
+      default:
+          break;
+      }
+  }
+
+  val_print(ERROR, "GET_PCIe_BDF_INFO: Invalid type %d\n", type);
+  return 0;
+}
+
+/**
+  @brief   Appends a function to g_pcie_bdf_table, doubling the table when it is
+           full. Entries stay contiguous so that device[] can be indexed directly.
+           1. Caller       -  val_pcie_create_device_bdf_table
+  @param   bdf   - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+
+  @return  0 on success, 1 if the table could not be grown
+**/
+static uint32_t
+val_pcie_bdf_table_add(uint32_t bdf)
+{
+  uint32_t capacity;
+  pcie_device_bdf_table *table;
+
+  if (g_pcie_bdf_table->num_entries == g_pcie_bdf_table_capacity)
+  {
+      capacity = g_pcie_bdf_table_capacity * 2;
+      table = (pcie_device_bdf_table *) pal_aligned_alloc(MEM_ALIGN_8K,
+                                                           PCIE_BDF_TABLE_BYTES(capacity));
+      if (!table)
+          return 1;
+
+      val_memcpy(table, g_pcie_bdf_table, PCIE_BDF_TABLE_BYTES(g_pcie_bdf_table->num_entries));
+      pal_mem_free_aligned(g_pcie_bdf_table);
+      g_pcie_bdf_table = table;
+      g_pcie_bdf_table_capacity = capacity;
+  }
+
+  g_pcie_bdf_table->device[g_pcie_bdf_table->num_entries].bdf = bdf;
+  g_pcie_bdf_table->device[g_pcie_bdf_table->num_entries].rp_bdf = 0;
+  g_pcie_bdf_table->num_entries++;
+
+  return 0;
+}
+
+/**
+  @brief   Returns 1 if the function implements the ARI extended capability. The
+           walk reads config space directly so that any PE can run it.
+  @param   bdf   - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+
+  @return  1 if ARI is implemented, else 0
+**/
+static uint32_t
+val_pcie_enum_has_ari(uint32_t bdf)
+{
+  uint32_t next_cap_offset;
+  uint32_t reg_value;
+  uint32_t num_cap = 0;
+
+  next_cap_offset = PCIE_ECAP_START;
+  while (next_cap_offset && (num_cap++ < PCIE_CAP_MAX_ENTRIES))
+  {
+      if (val_pcie_read_cfg(bdf, next_cap_offset, &reg_value) ||
+          (reg_value == PCIE_UNKNOWN_RESPONSE))
+          return 0;
+
+      if ((reg_value & PCIE_ECAP_CIDR_MASK) == ECID_ARICS)
+          return 1;
+
+      next_cap_offset = ((reg_value >> PCIE_ECAP_NCPR_SHIFT) & PCIE_ECAP_NCPR_MASK);
+  }
+
+  return 0;
+}
+
+/**
+  @brief   Probes the functions of a bus and records the ones that respond. Functions
+           1-7 of a device are probed only when its function 0 responds, unless the
+           function 0 of the bus implements ARI. Safe to run on any PE.
+  @param   seg      - Segment number
+  @param   bus      - Bus number
+  @param   bus_map  - PCIE_ENUM_BUS_WORDS words, bit (dev * PCIE_MAX_FUNC + func)
+                      is set for every function that responded
+  @param   err_bdf  - Function whose probe could not be mapped
+
+  @return  0 on success, PCIE_NO_MAPPING on a config space mapping issue
+**/
+static uint32_t
+val_pcie_enum_scan_bus(uint32_t seg, uint32_t bus, uint32_t *bus_map, uint32_t *err_bdf)
+{
+  uint32_t dev_index;
+  uint32_t func_index;
+  uint32_t bdf;
+  uint32_t bit;
+  uint32_t reg_value;
+  uint32_t ari = 0;
+
+  val_memory_set(bus_map, PCIE_ENUM_BUS_WORDS * sizeof(uint32_t), 0);
+
+  for (dev_index = 0; dev_index < PCIE_MAX_DEV; dev_index++)
+  {
+      for (func_index = 0; func_index < PCIE_MAX_FUNC; func_index++)
+      {
+          bit = (dev_index * PCIE_MAX_FUNC) + func_index;
+
+          /* A device without function 0 is absent */
+          if ((func_index != 0) && !ari &&
+              !(bus_map[(bit - func_index) / 32] & (1u << ((bit - func_index) % 32))))
+              break;
+
+          bdf = PCIE_CREATE_BDF(seg, bus, dev_index, func_index);
+          if (val_pcie_read_cfg(bdf, TYPE01_VIDR, &reg_value) == PCIE_NO_MAPPING) {
+              *err_bdf = bdf;
+              return PCIE_NO_MAPPING;
+          }
+
+          if (reg_value == PCIE_UNKNOWN_RESPONSE)
+              continue;
+
+          bus_map[bit / 32] |= (1u << (bit % 32));
+
+          /* With ARI the device number is part of the function number */
+          if (bit == 0)
+              ari = val_pcie_enum_has_ari(bdf);
+      }
+  }
+
+  return 0;
+}
+
+/**
+  @brief   Checks a function which responded to the enumeration probe and adds it
+           to g_pcie_bdf_table. Runs on the primary PE, in BDF table order.
+           1. Caller       -  val_pcie_create_device_bdf_table
+  @param   bdf   - Segment/Bus/Dev/Func in the format of PCIE_CREATE_BDF
+
+  @return  0 on success, 1 if the BDF table could not be grown
+**/
+static uint32_t
+val_pcie_enum_add_function(uint32_t bdf)
+{
+  uint32_t cid_offset;
+  uint32_t p_cap;
+  uint32_t status;
+  uint32_t dp_type;
+
+  /* Skip if the device is a host bridge */
+  if (val_pcie_is_host_bridge(bdf)) {
+      val_print(DEBUG, "       BDF 0x%x is a Host Bridge...Skipping\n", bdf);
+      return 0;
+  }
+
+#ifndef TARGET_LINUX
+  /* Enable memory access and bus master enable for all BDF's
+   * For BM systems, these bits are enabled during enumeration in PAL
+   * For linux, the driver takes care.
+  */
+  val_pcie_enable_bme(bdf);
+  val_pcie_enable_msa(bdf);
+#endif
+
+  /* Skip if the device is a PCI legacy device */
+  p_cap = val_pcie_find_capability(bdf, PCIE_CAP, CID_PCIECS, &cid_offset);
+  if (p_cap != PCIE_SUCCESS) {
+      val_print(DEBUG,
+        "       BDF 0x%x PCI Express capability not present...Skipping\n", bdf);
+      return 0;
+  }
+
+  status = pal_pcie_check_device_valid(bdf);
+  if (status) {
+      val_print(DEBUG,
+        "       BDF 0x%x Marked as invalid in Platform API...Skipping\n", bdf);
+      return 0;
+  }
+
+  dp_type = val_pcie_device_port_type(bdf);
+
+  /* Disable DPC for RP and DP */
+  if ((dp_type == RP) || (dp_type == DP))
+      val_pcie_disable_dpc(bdf);
+
+  /* RCiEP rules are for SBSA L6 */
+  if ((dp_type == RCiEP) || (dp_type == RCEC))
+      g_pcie_integrated_devices++;
+
+  /* iEP rules are for SBSA L6 */
+  if ((dp_type == iEP_EP) || (dp_type == iEP_RP))
+      g_pcie_integrated_devices++;
+
+  if (val_pcie_bdf_table_add(bdf)) {
+      val_print(ERROR, "       PCIe BDF table memory allocation failed\n");
+      return 1;
+  }
+
+  return 0;
+}
+
+#ifndef TARGET_LINUX
+/**
+  @brief   Probes the partitions assigned to a worker of the parallel enumeration.
+  @param   worker   - Worker number, 0 is the primary PE
+
+  @return  0 if all partitions were probed, else status of the first failed one
+**/
+static uint32_t
+val_pcie_enum_run_worker(uint32_t worker)
+{
+  uint32_t part_index;
+  uint32_t bus;
+  uint32_t *bus_map;
+  uint32_t status;
+  uint32_t worker_status = 0;
+  pcie_enum_part_t *part;
+
+  for (part_index = 0; part_index < g_pcie_enum_num_part; part_index++)
+  {
+      part = &g_pcie_enum_part[part_index];
+      if (part->worker != worker)
+          continue;
 
-          dev_ecam_base = val_pcie_get_ecam_base(bdf);
+      status = PCIE_SUCCESS;
+      for (bus = part->start_bus; bus <= part->end_bus; bus++)
+      {
+          /* The primary PE gave up waiting, its result is no longer used */
+          val_data_cache_ops_by_va((addr_t)&g_pcie_enum_abort, INVALIDATE);
+          if (g_pcie_enum_abort) {
+              status = PCIE_ENUM_PART_ABORTED;
+              break;
+          }
 
-          if ((ecam_base == dev_ecam_base) && (bus_num >= ecam_start_bus)
-              && (bus_num <= ecam_end_bus))
-          {
-              bdf_counter = 1;
-              bdf = PCIE_CREATE_BDF(seg_num, bus_num, dev_num, func_num);
-              val_print(TRACE, "  BDF: 0x%x\n", bdf);
-              val_print(TRACE, "  Seg: 0x%x, ", seg_num);
-              val_print(TRACE, "Bus: 0x%02x, ", bus_num);
-              val_print(TRACE, "Dev: 0x%02x, ", dev_num);
-              val_print(TRACE, "Func: 0x%x, ", func_num);
-              val_print(TRACE, "Dev ID: 0x%04x, ", device_id);
-              val_print(TRACE, "Vendor ID: 0x%04x\n", vendor_id);
+          bus_map = part->bus_map + ((bus - part->start_bus) * PCIE_ENUM_BUS_WORDS);
+          if (pal_pcie_check_bus_valid(bus)) {
+              val_memory_set(bus_map, PCIE_ENUM_BUS_WORDS * sizeof(uint32_t), 0);
+              continue;
           }
+
+          status = val_pcie_enum_scan_bus(part->seg, bus, bus_map, &part->err_bdf);
+          if (status)
+              break;
       }
-      if (bdf_counter == 0)
-          val_print(TRACE, "  No BDF devices in ECAM region index %d\n", ecam_index);
 
-      ecam_index++;
+      val_pe_cache_clean_invalidate_range((uint64_t)part->bus_map,
+                                          (part->end_bus - part->start_bus + 1) *
+                                          PCIE_ENUM_BUS_WORDS * sizeof(uint32_t));
+      part->status = status;
+      val_data_cache_ops_by_va((addr_t)&part->err_bdf, CLEAN_AND_INVALIDATE);
+      val_data_cache_ops_by_va((addr_t)&part->status, CLEAN_AND_INVALIDATE);
+
+      if (!worker_status)
+          worker_status = status;
   }
+
+  return worker_status;
 }
 
 /**
-  @brief   This API will call PAL layer to fill in the PCIe information
-           into the g_pcie_info_table pointer.
-           1. Caller       -  Application layer.
-           2. Prerequisite -  Memory allocated and passed as argument.
-  @param   pcie_info_table    Memory address where PCIe Information is populated
+  @brief   Entry of the secondary PEs during parallel enumeration. The worker number
+           is passed as the test data of the PE. The PE reports its result through
+           val_set_status, which clears its pending state.
+  @param   None
 
-  @return  Error if Input param is NULL
+  @return  None
 **/
-void
-val_pcie_create_info_table(uint64_t *pcie_info_table)
+static void
+val_pcie_enum_payload(void)
 {
-  uint32_t num_ecam;
+  uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
+  uint64_t data0;
+  uint64_t worker;
 
-  if (pcie_info_table == NULL) {
-      val_print(ERROR, "Input for Create Info table cannot be NULL\n");
-      return;
-  }
-  val_print(TRACE, " Creating PCIe INFO table\n");
+  val_get_test_data(index, &data0, &worker);
+  if (val_pcie_enum_run_worker((uint32_t)worker))
+      val_set_status(index, RESULT_FAIL(1));
+  else
+      val_set_status(index, RESULT_PASS);
+}
+#endif
 
-  g_pcie_info_table = (PCIE_INFO_TABLE *)pcie_info_table;
+/**
+  @brief   Frees the partitions and bus maps of the parallel enumeration. While a
+           timed out PE has not finished its partition it may still write them, so
+           the release is deferred to a later call once every partition is done.
+           1. Caller       -  val_pcie_create_device_bdf_table, val_pcie_free_info_table
+  @param   None
 
-  pal_pcie_create_info_table(g_pcie_info_table);
+  @return  None
+**/
+static void
+val_pcie_enum_free_parts(void)
+{
+  uint32_t part_index;
 
-  num_ecam = (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0);
-  val_print(INFO, " PCIE_INFO: Number of ECAM regions    :    %ld\n", num_ecam);
-  if (num_ecam == 0)
-      return;
+  for (part_index = 0; (g_pcie_enum_part != NULL) && (part_index < g_pcie_enum_num_part);
+       part_index++)
+  {
+      val_data_cache_ops_by_va((addr_t)&g_pcie_enum_part[part_index].status, INVALIDATE);
+      if (g_pcie_enum_part[part_index].status == PCIE_ENUM_PART_PENDING)
+          return;
+  }
 
-  val_pcie_enumerate();
+  if (g_pcie_enum_bus_map != NULL)
+      val_memory_free_aligned(g_pcie_enum_bus_map);
 
-  /* Create the list of valid Pcie Device Functions */
-  if (val_pcie_create_device_bdf_table()) {
-      val_print(ERROR, "   Create Bdf table failed.\n");
-      return;
-  }
+  if (g_pcie_enum_part != NULL)
+      val_memory_free(g_pcie_enum_part);
 
-  if (pal_pcie_check_device_list()) {
-    pcie_bdf_table_list_flag = 1;
-    val_print(ERROR, "Pcie device list doesn't match \
-                with platform pcie device hierarchy\n");
-  }
+  g_pcie_enum_bus_map = NULL;
+  g_pcie_enum_part = NULL;
+  g_pcie_enum_num_part = 0;
+}
 
-  val_pcie_print_device_info();
+#ifndef TARGET_LINUX
+/**
+  @brief   Cleans the ECAM lookup tables to the point of coherency, so that secondary
+           PEs started with their caches off read them through
+           val_pcie_ecam_base_lookup.
+  @param   None
+
+  @return  None
+**/
+static void
+val_pcie_enum_clean_ecam_map(void)
+{
+  val_data_cache_ops_by_va((addr_t)&g_pcie_info_table, CLEAN_AND_INVALIDATE);
+  val_pe_cache_clean_invalidate_range((uint64_t)g_pcie_info_table,
+                                      sizeof(PCIE_INFO_TABLE) +
+                                      g_pcie_info_table->num_entries *
+                                      sizeof(PCIE_INFO_BLOCK));
+
+  val_pe_cache_clean_invalidate_range((uint64_t)g_pcie_ecam_seg_slot,
+                                      sizeof(g_pcie_ecam_seg_slot));
+  val_data_cache_ops_by_va((addr_t)&g_pcie_ecam_bus_map, CLEAN_AND_INVALIDATE);
+  if (g_pcie_ecam_bus_map != NULL)
+      val_pe_cache_clean_invalidate_range((uint64_t)g_pcie_ecam_bus_map,
+                                          g_pcie_ecam_num_slots * PCIE_MAX_BUS *
+                                          sizeof(uint16_t));
 }
 
 /**
-  @brief  Sanity checks that all Endpoints must have a Rootport
+  @brief   Probes the buses of all ECAMs on all PEs. Every ECAM bus range is split in
+           partitions of PCIE_ENUM_BUS_ALIGN aligned bus counts, dealt round-robin to
+           the PEs. A partition whose PE cannot be started is probed by the primary
+           PE. If a PE does not complete in time the parallel result is dropped, so
+           that the caller falls back to the serial walk on its own map.
+           1. Caller       -  val_pcie_create_device_bdf_table
+           2. Prerequisite -  val_pe_create_info_table
+  @param   ecam_map   - Returns the bus map of each ECAM, indexed by ECAM index.
+                        PCIE_ENUM_BUS_WORDS words per bus, from the ECAM start bus.
 
-  @param  None
-  @return 0 if sanity check passes, 1 if sanity check fails
+  @return  0 on success, 1 if parallel enumeration is not used
 **/
-uint32_t val_pcie_populate_device_rootport(void)
+static uint32_t
+val_pcie_enum_parallel_scan(uint32_t **ecam_map)
 {
-  uint32_t bdf;
-  uint32_t rp_bdf;
-  uint32_t tbl_index;
-  pcie_device_bdf_table *bdf_tbl_ptr;
+  uint32_t num_pe;
+  uint32_t num_ecam;
+  uint32_t num_workers;
+  uint32_t ecam_index;
+  uint32_t start_bus;
+  uint32_t end_bus;
+  uint32_t total_bus = 0;
+  uint32_t chunk;
+  uint32_t part_index;
+  uint32_t pe_index;
+  uint32_t primary;
+  uint32_t worker;
+  uint32_t timeout;
+  uint32_t pending;
+  uint32_t own_shared_mem = 0;
+  uint32_t *map;
+  pcie_enum_part_t *part;
+
+  num_pe = val_pe_get_num();
+  num_ecam = (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0);
+  if (!acs_policy_get_pcie_parallel_enum() || (num_pe < 2) || (num_ecam == 0))
+      return 1;
 
-  bdf_tbl_ptr = val_pcie_bdf_table_ptr();
-  tbl_index = 0;
+  /* A PE that timed out in an earlier run may still own the previous partitions */
+  val_pcie_enum_free_parts();
+  if (g_pcie_enum_part != NULL)
+      return 1;
 
-  for (tbl_index = 0; tbl_index < bdf_tbl_ptr->num_entries; tbl_index++)
+  /* Split the buses of all ECAMs evenly across the PEs */
+  for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
   {
-      bdf = bdf_tbl_ptr->device[tbl_index].bdf;
-      val_print(DEBUG, "  Dev bdf 0x%06x", bdf);
+      start_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, ecam_index);
+      end_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, ecam_index);
+      total_bus += ((end_bus - start_bus + PCIE_ENUM_BUS_ALIGN) / PCIE_ENUM_BUS_ALIGN) *
+                   PCIE_ENUM_BUS_ALIGN;
+  }
 
-      /* Checks if the BDF has RootPort */
-      val_pcie_get_rootport(bdf, &rp_bdf);
+  num_workers = num_pe;
+  chunk = (total_bus + num_workers - 1) / num_workers;
+  chunk = ((chunk + PCIE_ENUM_BUS_ALIGN - 1) / PCIE_ENUM_BUS_ALIGN) * PCIE_ENUM_BUS_ALIGN;
 
-      bdf_tbl_ptr->device[tbl_index].rp_bdf = rp_bdf;
-      val_print(DEBUG, " RP bdf 0x%06x\n", rp_bdf);
+  g_pcie_enum_num_part = 0;
+  for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
+  {
+      start_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, ecam_index);
+      end_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, ecam_index);
+      g_pcie_enum_num_part += (end_bus - start_bus + chunk) / chunk;
+  }
+
+  g_pcie_enum_bus_map = val_aligned_alloc(MEM_ALIGN_4K,
+                                          total_bus * PCIE_ENUM_BUS_WORDS * sizeof(uint32_t));
+  g_pcie_enum_part = val_memory_calloc(g_pcie_enum_num_part, sizeof(pcie_enum_part_t));
+  if ((g_pcie_enum_bus_map == NULL) || (g_pcie_enum_part == NULL)) {
+      val_print(WARN, "\n       PCIe parallel enumeration allocation failed");
+      val_pcie_enum_free_parts();
+      return 1;
+  }
+
+  g_pcie_enum_abort = 0;
+  val_data_cache_ops_by_va((addr_t)&g_pcie_enum_abort, CLEAN_AND_INVALIDATE);
+
+  /* ECAM windows keep their MCFG order, buses stay ascending within each window */
+  map = g_pcie_enum_bus_map;
+  part_index = 0;
+  for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
+  {
+      start_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, ecam_index);
+      end_bus = (uint32_t)val_pcie_get_info(PCIE_INFO_END_BUS, ecam_index);
+      ecam_map[ecam_index] = map;
+
+      for (; start_bus <= end_bus; start_bus += chunk, part_index++)
+      {
+          part = &g_pcie_enum_part[part_index];
+          part->seg = (uint32_t)val_pcie_get_info(PCIE_INFO_SEGMENT, ecam_index);
+          part->start_bus = start_bus;
+          part->end_bus = ((end_bus - start_bus) < chunk) ? end_bus : (start_bus + chunk - 1);
+          part->worker = part_index % num_workers;
+          part->bus_map = map;
+          part->status = PCIE_ENUM_PART_PENDING;
+          map += chunk * PCIE_ENUM_BUS_WORDS;
+      }
+
+      map = ecam_map[ecam_index] +
+            (((end_bus - (uint32_t)val_pcie_get_info(PCIE_INFO_START_BUS, ecam_index) +
+               PCIE_ENUM_BUS_ALIGN) / PCIE_ENUM_BUS_ALIGN) *
+             PCIE_ENUM_BUS_ALIGN * PCIE_ENUM_BUS_WORDS);
+  }
+
+  val_pe_cache_clean_invalidate_range((uint64_t)g_pcie_enum_part,
+                                      g_pcie_enum_num_part * sizeof(pcie_enum_part_t));
+  val_data_cache_ops_by_va((addr_t)&g_pcie_enum_part, CLEAN_AND_INVALIDATE);
+  val_data_cache_ops_by_va((addr_t)&g_pcie_enum_num_part, CLEAN_AND_INVALIDATE);
+
+  /* Secondary PEs pick up their payload from the shared memory */
+  if (pal_mem_get_shared_addr() == 0) {
+      val_allocate_shared_mem();
+      own_shared_mem = 1;
+  }
+
+  val_pcie_enum_clean_ecam_map();
+
+  primary = val_pe_get_primary_index();
+  worker = 1;
+  for (pe_index = 0; (pe_index < num_pe) && (worker < num_workers); pe_index++)
+  {
+      if (pe_index == primary)
+          continue;
+
+      val_set_status(pe_index, RESULT_PENDING(0));
+      val_execute_on_pe(pe_index, val_pcie_enum_payload, worker);
+
+      /* The PE could not be started, probe its partitions here */
+      if (!IS_RESULT_PENDING(val_get_status(pe_index)))
+          (void)val_pcie_enum_run_worker(worker);
+
+      worker++;
+  }
+
+  (void)val_pcie_enum_run_worker(0);
+
+  timeout = TIMEOUT_LARGE;
+  do {
+      pending = 0;
+      for (part_index = 0; part_index < g_pcie_enum_num_part; part_index++)
+      {
+          part = &g_pcie_enum_part[part_index];
+          val_data_cache_ops_by_va((addr_t)&part->status, INVALIDATE);
+          if (part->status == PCIE_ENUM_PART_PENDING)
+              pending++;
+      }
+  } while (pending && --timeout);
+
+  /* A stalled PE may still write its partition, so none of the shared maps are
+   * trusted. The other workers stop at their next bus and the allocations are
+   * released once the stalled PE has finished.
+   */
+  if (pending) {
+      g_pcie_enum_abort = 1;
+      val_data_cache_ops_by_va((addr_t)&g_pcie_enum_abort, CLEAN_AND_INVALIDATE);
+
+      for (part_index = 0; part_index < g_pcie_enum_num_part; part_index++)
+      {
+          part = &g_pcie_enum_part[part_index];
+          if (part->status == PCIE_ENUM_PART_PENDING)
+              val_print(WARN, "\n       PCIe enumeration worker %d timed out", part->worker);
+      }
+
+      /* Stalled PEs must not stay pending for the next test, a late report
+         finds its PE no longer pending and is dropped */
+      for (pe_index = 0; pe_index < num_pe; pe_index++)
+      {
+          if ((pe_index != primary) && IS_RESULT_PENDING(val_get_status(pe_index)))
+              val_set_status(pe_index, RESULT_FAIL(0xF));
+      }
+
+      val_pcie_enum_free_parts();
+      return 1;
   }
+
+  val_pe_cache_invalidate_range((uint64_t)g_pcie_enum_bus_map,
+                                total_bus * PCIE_ENUM_BUS_WORDS * sizeof(uint32_t));
+
+  if (own_shared_mem)
+      val_free_shared_mem();
+
   return 0;
 }
+#endif
 
 /**
   @brief   This API creates the device bdf table from enumeration
@@ -524,15 +1823,18 @@ val_pcie_create_device_bdf_table()
   uint32_t start_bus;
   uint32_t end_bus;
   uint32_t bus_index;
-  uint32_t dev_index;
-  uint32_t func_index;
   uint32_t ecam_index;
+#ifndef TARGET_LINUX
+  uint32_t part_index;
+#endif
+  uint32_t bit;
   uint32_t bdf;
-  uint32_t reg_value;
-  uint32_t cid_offset;
-  uint32_t p_cap;
+  uint32_t err_bdf;
   uint32_t status;
-  uint32_t dp_type;
+  uint32_t parallel;
+  uint32_t local_map[PCIE_ENUM_BUS_WORDS];
+  uint32_t *bus_map;
+  uint32_t **ecam_map;
 
   /* if table is already present, return success */
   if (g_pcie_bdf_table)
@@ -549,6 +1851,8 @@ val_pcie_create_device_bdf_table()
   }
 
   g_pcie_bdf_table->num_entries = 0;
+  g_pcie_bdf_table_capacity = (PCIE_DEVICE_BDF_TABLE_SZ - sizeof(pcie_device_bdf_table)) /
+                              sizeof(pcie_device_attr);
   g_pcie_integrated_devices = 0;
 
   num_ecam = (uint32_t)val_pcie_get_info(PCIE_INFO_NUM_ECAM, 0);
@@ -558,6 +1862,29 @@ val_pcie_create_device_bdf_table()
       return 1;
   }
 
+  /* Probe the ECAMs on all PEs when enabled, else bus by bus below */
+  parallel = 0;
+#ifndef TARGET_LINUX
+  ecam_map = val_memory_calloc(num_ecam, sizeof(uint32_t *));
+  if ((ecam_map != NULL) && !val_pcie_enum_parallel_scan(ecam_map))
+  {
+      parallel = 1;
+      for (part_index = 0; part_index < g_pcie_enum_num_part; part_index++)
+      {
+          if (g_pcie_enum_part[part_index].status != PCIE_SUCCESS) {
+              /* Return if there is a bdf mapping issue */
+              val_print(ERROR, "\n       BDF 0x%x mapping issue",
+                        g_pcie_enum_part[part_index].err_bdf);
+              val_pcie_enum_free_parts();
+              val_memory_free(ecam_map);
+              return 1;
+          }
+      }
+  }
+#else
+  ecam_map = NULL;
+#endif
+
   for (ecam_index = 0; ecam_index < num_ecam; ecam_index++)
   {
       /* Derive ecam specific information */
@@ -574,81 +1901,50 @@ val_pcie_create_device_bdf_table()
               continue;
           }
 
-          for (dev_index = 0; dev_index < PCIE_MAX_DEV; dev_index++)
-          {
-              for (func_index = 0; func_index < PCIE_MAX_FUNC; func_index++)
-              {
-                  /* Form bdf using seg, bus, device, function numbers */
-                  bdf = PCIE_CREATE_BDF(seg_num, bus_index, dev_index, func_index);
-
-                  /* Probe pcie device Function with this bdf */
-                  if (val_pcie_read_cfg(bdf, TYPE01_VIDR, &reg_value) == PCIE_NO_MAPPING)
-                  {
-                      /* Return if there is a bdf mapping issue */
-                      val_print(ERROR, "\n       BDF 0x%x mapping issue", bdf);
-                      return 1;
-                  }
-
-                  /* Store the Function's BDF if there was a valid response */
-                  if (reg_value != PCIE_UNKNOWN_RESPONSE)
-                  {
-                      /* Skip if the device is a host bridge */
-                      if (val_pcie_is_host_bridge(bdf)) {
-                          val_print(DEBUG,
-                                     "       BDF 0x%x is a Host Bridge...Skipping\n", bdf);
-                          continue;
-                      }
-
-#ifndef TARGET_LINUX
-                      /* Enable memory access and bus master enable for all BDF's
-                       * For BM systems, these bits are enabled during enumeration in PAL
-                       * For linux, the driver takes care.
-                      */
-                      val_pcie_enable_bme(bdf);
-                      val_pcie_enable_msa(bdf);
-#endif
-
-                      /* Skip if the device is a PCI legacy device */
-                      p_cap = val_pcie_find_capability(
-                        bdf,
-                        PCIE_CAP,
-                        CID_PCIECS,
-                        &cid_offset);
-
-                      if (p_cap != PCIE_SUCCESS) {
-                          val_print(DEBUG,
-                          "       BDF 0x%x PCI Express capability not present...Skipping\n", bdf);
-                          continue;
-                      }
+          if (parallel) {
+              bus_map = ecam_map[ecam_index] + ((bus_index - start_bus) * PCIE_ENUM_BUS_WORDS);
+          } else {
+              bus_map = local_map;
+              if (val_pcie_enum_scan_bus(seg_num, bus_index, bus_map, &err_bdf)) {
+                  /* Return if there is a bdf mapping issue */
+                  val_print(ERROR, "\n       BDF 0x%x mapping issue", err_bdf);
+                  status = 1;
+                  goto exit;
+              }
+          }
 
-                      status = pal_pcie_check_device_valid(bdf);
-                      if (status) {
-                          val_print(DEBUG,
-                           "       BDF 0x%x Marked as invalid in Platform API...Skipping\n", bdf);
-                          continue;
-                      }
+          /* Store the BDFs of the Functions that gave a valid response */
+          for (bit = 0; bit < (PCIE_MAX_DEV * PCIE_MAX_FUNC); bit++)
+          {
+              if (!(bus_map[bit / 32] & (1u << (bit % 32))))
+                  continue;
+
+              bdf = PCIE_CREATE_BDF(seg_num, bus_index, bit / PCIE_MAX_FUNC,
+                                    bit % PCIE_MAX_FUNC);
+              if (val_pcie_enum_add_function(bdf)) {
+                  status = 1;
+                  goto exit;
+              }
+          }
+      }
+  }
 
-                      dp_type = val_pcie_device_port_type(bdf);
+  status = 0;
 
-                      /* Disable DPC for RP and DP */
-                      if ((dp_type == RP) || (dp_type == DP))
-                          val_pcie_disable_dpc(bdf);
+exit:
+  val_pcie_enum_free_parts();
 
-                      /* RCiEP rules are for SBSA L6 */
-                      if ((dp_type == RCiEP) || (dp_type == RCEC))
-                          g_pcie_integrated_devices++;
+  if (ecam_map != NULL)
+      val_memory_free(ecam_map);
 
-                      /* iEP rules are for SBSA L6 */
-                      if ((dp_type == iEP_EP) || (dp_type == iEP_RP))
-                          g_pcie_integrated_devices++;
+  if (status)
+      return status;
 
-                      g_pcie_bdf_table->device[g_pcie_bdf_table->num_entries++].bdf = bdf;
+  /* Index the table and capability offsets of every function */
+  val_pcie_create_bdf_index();
 
-                  }
-              }
-          }
-      }
-  }
+  /* Build the hierarchy used by the root port and downstream queries */
+  val_pcie_create_topology();
 
   /* Sanity Check : Confirm all EP (normal, integrated) have a rootport */
   val_pcie_populate_device_rootport();
@@ -737,6 +2033,16 @@ val_pcie_bdf_table_ptr()
 void
 val_pcie_free_info_table(void)
 {
+    val_pcie_cfg_cache_free();
+    val_pcie_free_topology();
+    val_pcie_free_bdf_index();
+    val_pcie_enum_free_parts();
+
+    if (g_pcie_ecam_bus_map != NULL) {
+        val_memory_free(g_pcie_ecam_bus_map);
+        g_pcie_ecam_bus_map = NULL;
+    }
+
     if (g_pcie_info_table != NULL) {
         pal_mem_free_aligned((void *)g_pcie_info_table);
         g_pcie_info_table = NULL;
@@ -913,12 +2219,17 @@ val_pcie_device_port_type(uint32_t bdf)
   uint32_t reg_value;
   uint32_t dp_type;
   uint32_t status;
+  uint32_t tbl_index;
+
+  /* Device/Port type is HwInit, answer from the enumeration time decode */
+  if (!val_pcie_bdf_attr_index(bdf, &tbl_index))
+      return g_pcie_bdf_attr.dp_type[tbl_index];
 
   /* Get the PCI Express Capability structure offset and
    * use that offset to read pci express capabilities register
    */
   val_pcie_find_capability(bdf, PCIE_CAP, CID_PCIECS, &pciecs_base);
-  status = val_pcie_read_cfg(bdf, pciecs_base + CIDR_OFFSET, &reg_value);
+  status = val_pcie_read_cfg_cached(bdf, pciecs_base + CIDR_OFFSET, &reg_value);
 
   if (status)
       return PCIE_UNKNOWN_RESPONSE;
@@ -959,18 +2270,48 @@ val_pcie_find_capability(uint32_t bdf, uint32_t cid_type, uint32_t cid, uint32_t
   uint32_t reg_value;
   uint32_t next_cap_offset;
   uint32_t ret;
+  uint32_t tbl_index;
+  uint32_t index;
+  uint32_t start;
+  uint32_t end;
+  pcie_cap_index *cap_idx;
+
+  /* Answer from the capability index when the function has one */
+  if ((g_pcie_cap_index != NULL) && !val_pcie_get_bdf_table_index(bdf, &tbl_index) &&
+      g_pcie_cap_index[tbl_index].valid)
+  {
+      cap_idx = &g_pcie_cap_index[tbl_index];
+      if (cid_type == PCIE_CAP) {
+          start = cap_idx->start;
+          end = start + cap_idx->num_cap;
+      } else if (cid_type == PCIE_ECAP) {
+          start = cap_idx->start + cap_idx->num_cap;
+          end = start + cap_idx->num_ecap;
+      } else
+          return PCIE_CAP_NOT_FOUND;
+
+      for (index = start; index < end; index++)
+      {
+          if (g_pcie_cap_pool[index].id == cid) {
+              *cid_offset = g_pcie_cap_pool[index].offset;
+              return PCIE_SUCCESS;
+          }
+      }
+
+      return (cid_type == PCIE_ECAP) ? cap_idx->ecap_status : PCIE_CAP_NOT_FOUND;
+  }
 
   if (cid_type == PCIE_CAP) {
 
       /* Search in PCIe configuration space */
-      ret = val_pcie_read_cfg(bdf, TYPE01_CPR, &reg_value);
+      ret = val_pcie_read_cfg_cached(bdf, TYPE01_CPR, &reg_value);
       if (ret == PCIE_NO_MAPPING || reg_value == PCIE_UNKNOWN_RESPONSE)
           return ret;
 
       next_cap_offset = (reg_value & TYPE01_CPR_MASK);
       while (next_cap_offset)
       {
-          val_pcie_read_cfg(bdf, next_cap_offset, &reg_value);
+          val_pcie_read_cfg_cached(bdf, next_cap_offset, &reg_value);
           if ((reg_value & PCIE_CIDR_MASK) == cid)
           {
               *cid_offset = next_cap_offset;
@@ -985,7 +2326,7 @@ val_pcie_find_capability(uint32_t bdf, uint32_t cid_type, uint32_t cid, uint32_t
       next_cap_offset = PCIE_ECAP_START;
       while (next_cap_offset)
       {
-          val_pcie_read_cfg(bdf, next_cap_offset, &reg_value);
+          val_pcie_read_cfg_cached(bdf, next_cap_offset, &reg_value);
 
           /* if data at next ECAP offset reads 0xFFFF-FFFF, exit with failure code */
           if (reg_value == PCIE_UNKNOWN_RESPONSE)
@@ -1520,9 +2861,14 @@ val_pcie_function_header_type(uint32_t bdf)
 {
 
   uint32_t reg_value;
+  uint32_t tbl_index;
+
+  /* Header type is read-only, answer from the enumeration time decode */
+  if (!val_pcie_bdf_attr_index(bdf, &tbl_index))
+      return g_pcie_bdf_attr.hdr_type[tbl_index];
 
   /* Read four bytes of config space starting from cache line size register */
-  val_pcie_read_cfg(bdf, TYPE01_CLSR, &reg_value);
+  val_pcie_read_cfg_cached(bdf, TYPE01_CLSR, &reg_value);
 
   /* Extract header type register value */
   reg_value = ((reg_value >> TYPE01_HTR_SHIFT) & TYPE01_HTR_MASK);
@@ -1636,11 +2982,56 @@ val_pcie_get_downstream_function(uint32_t bdf, uint32_t *dsf_bdf)
   uint32_t reg_value;
   uint32_t type1_bdf;
   uint32_t type1_flag;
+  uint32_t bus;
+  uint32_t entry;
+  uint32_t type0_entry;
+  uint32_t type1_entry;
+  uint32_t tbl_index;
+  pcie_topology_bus *bus_node;
 
   type1_bdf = 0;
   *dsf_bdf = 0;
   type1_flag = 0;
 
+  /*
+   * Walk only the buses below the bridge using the topology. The first
+   * function in table order wins, type 0 functions before type 1 functions.
+   */
+  if (!val_pcie_bdf_attr_index(bdf, &tbl_index) &&
+      (g_pcie_bdf_attr.hdr_type[tbl_index] == TYPE1_HEADER))
+  {
+      seg = PCIE_EXTRACT_BDF_SEG(bdf);
+      type0_entry = 0;
+      type1_entry = 0;
+
+      for (bus = g_pcie_bdf_attr.sec_bus[tbl_index]; bus <= g_pcie_bdf_attr.sub_bus[tbl_index];
+           bus++)
+      {
+          bus_node = val_pcie_topology_get_bus(seg, bus);
+          if (bus_node == NULL)
+              continue;
+
+          for (entry = bus_node->first; entry != 0;
+               entry = g_pcie_bdf_attr.next_on_bus[entry - 1])
+          {
+              if (g_pcie_bdf_attr.hdr_type[entry - 1] == TYPE0_HEADER) {
+                  if ((type0_entry == 0) || (entry < type0_entry))
+                      type0_entry = entry;
+              } else if ((type1_entry == 0) || (entry < type1_entry))
+                  type1_entry = entry;
+          }
+      }
+
+      if (type0_entry == 0)
+          type0_entry = type1_entry;
+
+      if (type0_entry == 0)
+          return 1;
+
+      *dsf_bdf = g_pcie_bdf_table->device[type0_entry - 1].bdf;
+      return 0;
+  }
+
   /*
    * Read four bytes of config space starting from Primary Bus num
    * register and extract the Secondary and Subordinate Bus numbers
@@ -1708,6 +3099,7 @@ val_pcie_get_rootport(uint32_t bdf, uint32_t *rp_bdf)
   uint32_t seg_num;
   uint32_t reg_value;
   uint32_t dp_type;
+  pcie_topology_bus *bus_node;
 
   index = 0;
 
@@ -1729,6 +3121,18 @@ val_pcie_get_rootport(uint32_t bdf, uint32_t *rp_bdf)
       return 1;
   }
 
+  /* Look up the root port whose bus range covers the function's bus */
+  if (g_pcie_bdf_attr.dp_type != NULL)
+  {
+      bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(bdf), PCIE_EXTRACT_BDF_BUS(bdf));
+      if ((bus_node != NULL) && (bus_node->rp != 0)) {
+          *rp_bdf = g_pcie_bdf_table->device[bus_node->rp - 1].bdf;
+          return 0;
+      }
+
+      index = g_pcie_bdf_table->num_entries;
+  }
+
   while (index < g_pcie_bdf_table->num_entries)
   {
       *rp_bdf = g_pcie_bdf_table->device[index++].bdf;
@@ -2314,11 +3718,28 @@ val_pcie_parent_is_rootport(uint32_t dsf_bdf, uint32_t *rp_bdf)
   uint32_t tbl_index;
   uint32_t reg_value;
   pcie_device_bdf_table *bdf_tbl_ptr;
+  pcie_topology_bus *bus_node;
 
   tbl_index = 0;
   dsf_bus = PCIE_EXTRACT_BDF_BUS(dsf_bdf);
   bdf_tbl_ptr = val_pcie_bdf_table_ptr();
 
+  /* Bus 0 is never the secondary bus of a bridge */
+  if (dsf_bus == 0)
+      return 1;
+
+  /* The root port covering the bus is the parent if the bus is its secondary
+     bus, otherwise another bridge sits in between */
+  bus_node = val_pcie_topology_get_bus(PCIE_EXTRACT_BDF_SEG(dsf_bdf), dsf_bus);
+  if ((g_pcie_bdf_attr.dp_type != NULL) && (bus_node != NULL))
+  {
+      if ((bus_node->rp == 0) || (g_pcie_bdf_attr.sec_bus[bus_node->rp - 1] != dsf_bus))
+          return 1;
+
+      *rp_bdf = bdf_tbl_ptr->device[bus_node->rp - 1].bdf;
+      return 0;
+  }
+
   while (tbl_index < bdf_tbl_ptr->num_entries)
   {
       bdf = bdf_tbl_ptr->device[tbl_index++].bdf;
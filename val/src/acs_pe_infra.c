@@ -22,6 +22,7 @@
 #include "acs_exception.h"
 #include "val_interface.h"
 #include "pal_interface.h"
+#include "acs_memory.h"
 
 PE_SMBIOS_PROCESSOR_INFO_TABLE *g_smbios_info_table;
 int32_t gPsciConduit;
@@ -41,6 +42,104 @@ ARM_SMC_ARGS g_smc_args;
 /* global variable to store primary PE index */
 uint32_t g_primary_pe_index = 0;
 
+/* MPIDR to PE index hash, open addressed with linear probing. Built by
+   val_pe_create_info_table() and only read afterwards. */
+typedef struct {
+  uint64_t mpidr;
+  uint32_t index;
+  uint32_t valid;
+} PE_INDEX_ENTRY;
+
+static PE_INDEX_ENTRY *g_pe_index_hash;
+static uint32_t g_pe_index_mask;
+static uint32_t g_pe_index_gen;
+
+/* Each PE caches its own index in TPIDR_EL2 (TPIDR_EL1 at EL1), tagged with
+   the generation of the hash it was looked up in */
+#define PE_INDEX_TAG        (0xACE5ull << 48)
+#define PE_INDEX_TAG_MASK   (0xFFFFull << 48)
+#define PE_INDEX_GEN_SHIFT  32
+#define PE_INDEX_GEN_MASK   0xFFFFull
+
+static uint32_t
+val_pe_index_hash(uint64_t mpid)
+{
+  /* Aff3 is folded next to Aff2..Aff0 before mixing */
+  uint64_t aff = (mpid & 0xFFFFFF) | ((mpid >> 8) & 0xFF000000);
+
+  return (uint32_t)((aff * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+/**
+  @brief   Build the MPIDR to PE index hash from g_pe_info_table and clean it
+           to the point of coherency so secondary PEs can read it.
+  @param   None
+  @return  None, lookups walk g_pe_info_table if memory is not available.
+**/
+static void
+val_pe_build_index(void)
+{
+  PE_INFO_ENTRY *entry = g_pe_info_table->pe_info;
+  uint32_t num_pe = val_pe_get_num();
+  uint32_t size = 1, i, slot;
+
+  if (g_pe_index_hash != NULL) {
+      val_memory_free(g_pe_index_hash);
+      g_pe_index_hash = NULL;
+  }
+
+  while (size < 2 * num_pe)
+      size <<= 1;
+
+  g_pe_index_hash = val_memory_calloc(size, sizeof(PE_INDEX_ENTRY));
+  if (g_pe_index_hash == NULL) {
+      val_print(WARN, " PE_INFO: No memory for MPIDR index, using table walk\n");
+      return;
+  }
+
+  for (i = 0; i < num_pe; i++) {
+      slot = val_pe_index_hash(entry[i].mpidr) & (size - 1);
+      while (g_pe_index_hash[slot].valid)
+          slot = (slot + 1) & (size - 1);
+
+      g_pe_index_hash[slot].mpidr = entry[i].mpidr & MPIDR_AFF_MASK;
+      g_pe_index_hash[slot].index = entry[i].pe_num;
+      g_pe_index_hash[slot].valid = 1;
+  }
+
+  for (i = 0; i < size; i++)
+      val_data_cache_ops_by_va((addr_t)&g_pe_index_hash[i], CLEAN_AND_INVALIDATE);
+
+  g_pe_index_mask = size - 1;
+  g_pe_index_gen++;
+  val_data_cache_ops_by_va((addr_t)&g_pe_index_hash, CLEAN_AND_INVALIDATE);
+  val_data_cache_ops_by_va((addr_t)&g_pe_index_mask, CLEAN_AND_INVALIDATE);
+  val_data_cache_ops_by_va((addr_t)&g_pe_index_gen, CLEAN_AND_INVALIDATE);
+}
+
+#ifndef TARGET_LINUX
+static uint64_t
+val_pe_index_cache_read(void)
+{
+  if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      return read_tpidr_el2();
+
+  return read_tpidr_el1();
+}
+
+static void
+val_pe_index_cache_write(uint32_t index)
+{
+  uint64_t value = PE_INDEX_TAG |
+                   ((g_pe_index_gen & PE_INDEX_GEN_MASK) << PE_INDEX_GEN_SHIFT) | index;
+
+  if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      write_tpidr_el2(value);
+  else
+      write_tpidr_el1(value);
+}
+#endif
+
 /**
   @brief   This API will call PAL layer to fill in the PE information
            into the g_pe_info_table pointer.
@@ -88,6 +187,8 @@ val_pe_create_info_table(uint64_t *pe_info_table)
       return ACS_STATUS_ERR;
   }
 
+  val_pe_build_index();
+
 #ifndef TARGET_LINUX
 val_print(INFO, " Primary PE: MIDR_EL1                 :    0x%llx \n",
                                                                      val_pe_reg_read(MIDR_EL1));
@@ -112,6 +213,11 @@ val_print(INFO, " Primary PE: MIDR_EL1                 :    0x%llx \n",
 void
 val_pe_free_info_table(void)
 {
+    if (g_pe_index_hash != NULL) {
+        val_memory_free(g_pe_index_hash);
+        g_pe_index_hash = NULL;
+    }
+
     if (g_pe_info_table != NULL) {
         pal_mem_free_aligned((void *)g_pe_info_table);
         g_pe_info_table = NULL;
@@ -191,6 +297,8 @@ val_pe_get_mpid_index(uint32_t index)
   @brief   This API returns the index of the PE whose MPIDR matches with the input MPIDR
            1. Caller       -  Test Suite, VAL
            2. Prerequisite -  val_create_peinfo_table
+           The index of the running PE is cached in its TPIDR, other MPIDRs
+           are looked up in the hash built by val_pe_create_info_table().
   @param   mpid - the mpidr value of pE whose index is returned.
   @return  Index of PE
 **/
@@ -200,6 +308,39 @@ val_pe_get_index_mpid(uint64_t mpid)
 
   PE_INFO_ENTRY *entry;
   uint32_t i = g_pe_info_table->header.num_of_pe;
+  uint32_t slot;
+#ifndef TARGET_LINUX
+  uint64_t cached;
+  uint32_t own = 0;
+
+  cached = val_pe_index_cache_read();
+  if ((cached & PE_INDEX_TAG_MASK) == PE_INDEX_TAG) {
+      own = (mpid == val_pe_get_mpid());
+      if (own && (((cached >> PE_INDEX_GEN_SHIFT) & PE_INDEX_GEN_MASK) ==
+                  (g_pe_index_gen & PE_INDEX_GEN_MASK)))
+          return (uint32_t)cached;
+  } else {
+      own = (mpid == val_pe_get_mpid());
+  }
+#endif
+
+  if (g_pe_index_hash != NULL) {
+      mpid &= MPIDR_AFF_MASK;
+      slot = val_pe_index_hash(mpid) & g_pe_index_mask;
+
+      while (g_pe_index_hash[slot].valid) {
+          if (g_pe_index_hash[slot].mpidr == mpid) {
+#ifndef TARGET_LINUX
+              if (own)
+                  val_pe_index_cache_write(g_pe_index_hash[slot].index);
+#endif
+              return g_pe_index_hash[slot].index;
+          }
+          slot = (slot + 1) & g_pe_index_mask;
+      }
+
+      return 0x0;  //Return index 0 as a safe failsafe value
+  }
 
   entry = g_pe_info_table->pe_info;
 
@@ -238,6 +379,9 @@ val_test_entry(void)
   val_get_test_data(val_pe_get_index_mpid(val_pe_get_mpid()), (uint64_t *)&vector, &test_arg);
   vector(test_arg);
 
+  /* With the worker pool, wait for further payloads instead */
+  val_pe_pool_park();
+
   // We have completed our TEST code. So, switch off the PE now
   smc_args.Arg0 = ARM_SMC_ID_PSCI_CPU_OFF;
   smc_args.Arg1 = val_pe_get_mpid();
@@ -253,17 +397,34 @@ val_test_entry(void)
   @param   index - Index of the PE to be woken up
   @param   payload - Function pointer of the test to be executed on the PE
   @param   test_input - arguments to be passed to the test.
-  @return  None
+  @return  ACS_STATUS_PASS if the payload was handed to the PE,
+           ACS_STATUS_SKIP if the PE is busy or already on,
+           ACS_STATUS_FAIL otherwise. The PE status is set on failure.
 **/
-void
+uint32_t
 val_execute_on_pe(uint32_t index, void (*payload)(void), uint64_t test_input)
 {
 
   int timeout = TIMEOUT_LARGE;
+  uint32_t status;
+
   if (index > g_pe_info_table->header.num_of_pe) {
       val_print(ERROR, "Input Index exceeds Num of PE %x\n", index);
       val_report_status(index, RESULT_FAIL(0xFF), NULL);
-      return;
+      return ACS_STATUS_FAIL;
+  }
+
+  /* A PE parked in the worker pool only needs its doorbell rung */
+  val_set_test_data(index, (uint64_t)payload, test_input);
+  status = val_pe_pool_post(index);
+  if (status == ACS_STATUS_PASS)
+      return ACS_STATUS_PASS;
+
+  if (status == ACS_STATUS_SKIP) {
+      val_print(WARN, "\n       WARNING: Skipping test for PE index %d "
+                              "since it is still busy\n", index);
+      val_set_status(index, RESULT_SKIP(0x120 - (int)ARM_SMC_PSCI_RET_ALREADY_ON));
+      return ACS_STATUS_SKIP;
   }
 
   do {
@@ -278,24 +439,28 @@ val_execute_on_pe(uint32_t index, void (*payload)(void), uint64_t test_input)
 
   } while (g_smc_args.Arg0 == (uint64_t)ARM_SMC_PSCI_RET_ALREADY_ON && timeout--);
 
+  if (g_smc_args.Arg0 != 0)
+      val_pe_pool_start_failed(index);
+
   if (g_smc_args.Arg0 == (uint64_t)ARM_SMC_PSCI_RET_ALREADY_ON) {
       val_print(ERROR, "\n       PSCI_CPU_ON: cpu already on");
       val_print(WARN, "\n       WARNING: Skipping test for PE index %d "
                               "since it is already on\n", index);
 
       val_set_status(index, RESULT_SKIP(0x120 - (int)g_smc_args.Arg0));
-      return;
+      return ACS_STATUS_SKIP;
   }
   else {
       if(g_smc_args.Arg0 == 0) {
           val_print(TRACE, "\n       PSCI_CPU_ON: success");
-          return;
+          return ACS_STATUS_PASS;
       }
       else
           val_print(ERROR, "\n       PSCI_CPU_ON: failure[%d]", g_smc_args.Arg0);
 
   }
   val_set_status(index, RESULT_FAIL(0x120 - (int)g_smc_args.Arg0));
+  return ACS_STATUS_FAIL;
 }
 
 /**
@@ -22,8 +22,6 @@
 #include "acs_memory.h"
 #include "acs_mmu.h"
 
-#define get_min(a, b) ((a) < (b))?(a):(b)
-
 #define PGT_DEBUG_LEVEL TRACE
 IOREMMAP_LIST *ioremmap_list;
 
@@ -31,8 +29,6 @@ IOREMMAP_LIST *ioremmap_list;
 static uint32_t page_size;
 static uint32_t bits_per_level;
 static uint64_t pgt_addr_mask;
-uint64_t is_values_init = 0;
-uint64_t offset = 0;
 
 typedef struct
 {
@@ -45,73 +41,150 @@ typedef struct
     uint32_t nbits;
 } tt_descriptor_t;
 
+/* Table pages are carved from chunks of PGT_POOL_BATCH pages. Freed table
+   pages go back to the pool, and a chunk is returned to the heap as soon as
+   none of its pages is in use, so the pool drains with the tables built by a
+   test. Tables added to a hierarchy which may be live are allocated outside
+   the pool since they usually stay in place. */
+#define PGT_POOL_BATCH       16
+#define PGT_POOL_MAX_CHUNKS  64
+
 typedef struct {
-    uint32_t l0_index;
-    uint32_t l1_index;
-    uint32_t l2_index;
-    uint32_t l3_index;
-    uint64_t size_used;
-} acs_pgt_t;
+    uint8_t  *base;
+    uint32_t num_pages;
+    uint32_t in_use;
+} pgt_pool_chunk_t;
+
+static pgt_pool_chunk_t pgt_pool_chunk[PGT_POOL_MAX_CHUNKS];
+static uint32_t pgt_pool_num_chunks;
+static uint64_t *pgt_pool_free_list;
+
+/* Set while val_pgt_create() updates a caller supplied hierarchy. It may be
+   the installed PE hierarchy, which also maps the running code, stack and
+   heap, or an SMMU hierarchy whose TLBs are not maintained from the PE. Its
+   descriptors are therefore written directly, without break-before-make or
+   PE TLB maintenance, the contiguous hint is never set on it, and tables it
+   no longer references are not freed. */
+static uint32_t pgt_live;
 
-static acs_pgt_t acs_pgt_info;
+/**
+  @brief  Return the pool chunk holding a table page
 
-void setup_acs_pgt_values(void)
+  @param  page  Table page
+
+  @return Chunk, NULL if the page was not allocated from the pool
+**/
+static pgt_pool_chunk_t *pgt_pool_find_chunk(void *page)
 {
-    acs_pgt_info.l0_index = 0;
-    acs_pgt_info.l1_index = 0;
-    acs_pgt_info.l2_index = 0;
-    acs_pgt_info.l3_index = 0;
-    acs_pgt_info.size_used = 0;
+    uint32_t i;
+    uint8_t *addr = page;
+
+    for (i = 0; i < pgt_pool_num_chunks; i++) {
+        if ((addr >= pgt_pool_chunk[i].base) &&
+            (addr < pgt_pool_chunk[i].base + (uint64_t)pgt_pool_chunk[i].num_pages * page_size))
+            return &pgt_pool_chunk[i];
+    }
+
+    return NULL;
 }
 
+/**
+  @brief  Add a chunk of PGT_POOL_BATCH pages to the pool free list
 
-static
-uint32_t get_pgt_index(uint32_t level)
+  @return 0 if Success
+**/
+static uint32_t pgt_pool_refill(void)
 {
-    switch (level)
-    {
-        case(PGT_LEVEL_0):
-            return acs_pgt_info.l0_index;
-        case(PGT_LEVEL_1):
-            return acs_pgt_info.l1_index;
-        case(PGT_LEVEL_2):
-            return acs_pgt_info.l2_index;
-        case(PGT_LEVEL_3):
-            return acs_pgt_info.l3_index;
-        default:
-            return 0;
+    uint8_t *base;
+    uint32_t i;
+
+    if (pgt_pool_num_chunks == PGT_POOL_MAX_CHUNKS)
+        return ACS_STATUS_ERR;
+
+    /* Pool chunks are reused by later tests, keep them out of a test arena */
+    val_memory_persist_begin();
+    base = val_memory_alloc_pages(PGT_POOL_BATCH);
+    val_memory_persist_end();
+    if (base == NULL)
+        return ACS_STATUS_ERR;
+
+    pgt_pool_chunk[pgt_pool_num_chunks].base = base;
+    pgt_pool_chunk[pgt_pool_num_chunks].num_pages = PGT_POOL_BATCH;
+    pgt_pool_chunk[pgt_pool_num_chunks].in_use = 0;
+    pgt_pool_num_chunks++;
+
+    for (i = PGT_POOL_BATCH; i > 0; i--) {
+        *(uint64_t *)(base + (uint64_t)(i - 1) * page_size) = (uint64_t)pgt_pool_free_list;
+        pgt_pool_free_list = (uint64_t *)(base + (uint64_t)(i - 1) * page_size);
     }
+
+    return 0;
 }
 
-static
-void increment_pgt_index(uint32_t level, uint32_t max_index)
+/**
+  @brief  Allocate a zeroed translation table page
+
+  @return Table page, NULL if no memory is available
+**/
+static uint64_t *pgt_alloc_table(void)
 {
-    switch (level)
-    {
-        case(PGT_LEVEL_1):
-            if (acs_pgt_info.l1_index == (max_index - 1)) {
-                acs_pgt_info.l1_index = 0;
-                acs_pgt_info.l0_index++;
-            }
-            break;
+    uint64_t *page;
+
+    if (pgt_live || ((pgt_pool_free_list == NULL) && pgt_pool_refill())) {
+        /* Live hierarchy or pool exhausted, use a single page from the heap */
+        val_memory_persist_begin();
+        page = val_memory_alloc_pages(1);
+        val_memory_persist_end();
+        if (page != NULL)
+            val_memory_set(page, page_size, 0);
+        return page;
+    }
 
-        case(PGT_LEVEL_2):
-            if (acs_pgt_info.l2_index == (max_index - 1)) {
-                acs_pgt_info.l2_index = 0;
-                acs_pgt_info.l1_index++;
-            }
-            break;
+    page = pgt_pool_free_list;
+    pgt_pool_free_list = (uint64_t *)*page;
+    pgt_pool_find_chunk(page)->in_use++;
 
-        case(PGT_LEVEL_3):
-            if (acs_pgt_info.l3_index == (max_index - 1)) {
-                acs_pgt_info.l3_index = 0;
-                acs_pgt_info.l2_index++;
-            } else
-                acs_pgt_info.l3_index++;
-            break;
-        default:
-            break;
+    val_memory_set(page, page_size, 0);
+    return page;
+}
+
+/**
+  @brief  Free a translation table page
+
+  @param  page  Table page from pgt_alloc_table() or supplied by the caller
+
+  @return None
+**/
+static void pgt_free_table(uint64_t *page)
+{
+    pgt_pool_chunk_t *chunk = pgt_pool_find_chunk(page);
+    uint64_t **link;
+    uint8_t *addr;
+
+    if (chunk == NULL) {
+        val_memory_free_pages(page, 1);
+        return;
+    }
+
+    *page = (uint64_t)pgt_pool_free_list;
+    pgt_pool_free_list = page;
+
+    if (--chunk->in_use)
+        return;
+
+    /* Unlink the pages of the chunk from the free list and return it */
+    link = &pgt_pool_free_list;
+    while (*link != NULL) {
+        addr = (uint8_t *)*link;
+        if ((addr >= chunk->base) &&
+            (addr < chunk->base + (uint64_t)chunk->num_pages * page_size))
+            *link = (uint64_t *)**link;
+        else
+            link = (uint64_t **)*link;
     }
+
+    val_memory_free_pages(chunk->base, chunk->num_pages);
+    *chunk = pgt_pool_chunk[--pgt_pool_num_chunks];
 }
 
 static
@@ -337,6 +410,34 @@ uint64_t *val_find_pte(pgt_descriptor_t pgt_desc, uint64_t virtual_address)
         bits_at_this_level = bits_per_level;
     }
 }
+/**
+  @brief  Clear the contiguous hint on the run holding a descriptor, before
+          the descriptor is changed on its own. The other entries of the run
+          keep their output address, so a TLB entry cached for the run still
+          translates them correctly; the caller invalidates the changed VAs.
+
+  @param  pte  Descriptor within a contiguous run
+
+  @return None
+**/
+static void pgt_break_contig(uint64_t *pte)
+{
+    uint64_t *run = (uint64_t *)((uint64_t)pte &
+                                 ~(uint64_t)(PGT_CONTIG_ENTRIES * PGT_DESC_SIZE - 1));
+    uint32_t i, contig = 0;
+
+    for (i = 0; i < PGT_CONTIG_ENTRIES; i++)
+        contig |= ((run[i] & PGT_DESC_CONTIG) != 0);
+
+    if (!contig)
+        return;
+
+    for (i = 0; i < PGT_CONTIG_ENTRIES; i++)
+        run[i] &= ~PGT_DESC_CONTIG;
+
+    val_pe_cache_clean_range((uint64_t)run, PGT_CONTIG_ENTRIES * PGT_DESC_SIZE);
+}
+
 /**
   @brief  This API to remap the physical address with attributes
 
@@ -375,6 +476,8 @@ uint64_t val_pgt_ioremap_attr(pgt_descriptor_t pgt_desc,
             continue;
         }
         flag = 1;
+        if (*pte & PGT_DESC_CONTIG)
+            pgt_break_contig(pte);
         old_mair_val = (*pte >> MEM_ATTR_INDX_SHIFT) & MEM_ATTR_INDX_MASK;
         val_get_index_attr(old_mair_val, &old_attr);
         val_pgt_set_pte_attr(pte, mair_val);
@@ -415,6 +518,162 @@ uint64_t val_pgt_ioremap_attr(pgt_descriptor_t pgt_desc,
         return PTE_NOT_FOUND;
 }
 
+static void free_translation_table(uint64_t *tt_base, uint32_t bits_at_this_level,
+                                   uint32_t this_level);
+
+/**
+  @brief  Check whether a level may hold block descriptors
+
+  @param  level  Translation level
+
+  @return 1 if blocks are allowed
+**/
+static uint32_t pgt_block_allowed(uint32_t level)
+{
+    /* Without FEAT_LPA/LPA2, blocks start at L1 for 4KB and at L2 otherwise */
+    if (page_size == PAGE_SIZE_4K)
+        return level >= PGT_LEVEL_1;
+
+    return level >= PGT_LEVEL_2;
+}
+
+/**
+  @brief  Check whether a descriptor maps memory at the given level
+
+  @param  desc   Descriptor
+  @param  level  Translation level of the table holding desc
+
+  @return 1 for a page or block descriptor
+**/
+static uint32_t pgt_is_leaf(uint64_t desc, uint32_t level)
+{
+    if (level == PGT_LEVEL_3)
+        return IS_PGT_ENTRY_PAGE(desc);
+
+    return IS_PGT_ENTRY_BLOCK(desc);
+}
+
+/**
+  @brief  Recompute the contiguous hint for the groups of a table that
+          overlap the entries [first, last]. Only used on tables no walker
+          can be using, as the hint is changed without break-before-make.
+
+  @param  tt_base  Translation table
+  @param  first    First entry updated
+  @param  last     Last entry updated
+  @param  level    Translation level of the table
+
+  @return None
+**/
+static void pgt_update_contig(uint64_t *tt_base, uint64_t first, uint64_t last, uint32_t level)
+{
+    uint64_t size, desc, out_base, i, k;
+    uint32_t contig;
+
+    /* The hint is only used with the 4KB granule, where runs are 16 entries
+       at every level */
+    if ((page_size != PAGE_SIZE_4K) || !pgt_block_allowed(level))
+        return;
+
+    size = get_block_size(level);
+
+    for (i = first & ~(uint64_t)(PGT_CONTIG_ENTRIES - 1); i <= last; i += PGT_CONTIG_ENTRIES) {
+        desc = tt_base[i] & ~PGT_DESC_CONTIG;
+        out_base = desc & ~PGT_DESC_ATTRIBUTES_MASK & ~(size - 1);
+        contig = pgt_is_leaf(desc, level) &&
+                 ((out_base & ((PGT_CONTIG_ENTRIES * size) - 1)) == 0);
+
+        /* Entries of a run differ only in their output address */
+        for (k = 1; contig && (k < PGT_CONTIG_ENTRIES); k++)
+            contig = ((tt_base[i + k] & ~PGT_DESC_CONTIG) == (desc + k * size));
+
+        for (k = 0; k < PGT_CONTIG_ENTRIES; k++) {
+            if (contig)
+                tt_base[i + k] |= PGT_DESC_CONTIG;
+            else if (pgt_is_leaf(tt_base[i + k], level))
+                tt_base[i + k] &= ~PGT_DESC_CONTIG;
+        }
+    }
+}
+
+/**
+  @brief  Clear the contiguous hint of a caller supplied table for the groups
+          that overlap the entries [first, last], before those entries change
+
+  @param  tt_base  Translation table
+  @param  first    First entry to be updated
+  @param  last     Last entry to be updated
+  @param  level    Translation level of the table
+
+  @return None
+**/
+static void pgt_clear_contig(uint64_t *tt_base, uint64_t first, uint64_t last, uint32_t level)
+{
+    uint64_t i;
+
+    if (!pgt_live || (page_size != PAGE_SIZE_4K) || !pgt_block_allowed(level))
+        return;
+
+    for (i = first & ~(uint64_t)(PGT_CONTIG_ENTRIES - 1); i <= last; i += PGT_CONTIG_ENTRIES)
+        pgt_break_contig(&tt_base[i]);
+}
+
+/**
+  @brief  Return the next level table of a descriptor, allocating it if the
+          descriptor is invalid. A block descriptor is split into a table
+          which maps the same memory with the same attributes.
+
+  @param  table_desc  Descriptor to follow
+  @param  level       Translation level of the table holding table_desc
+  @param  block_size  Size mapped by table_desc
+
+  @return Next level table, NULL if allocation failed
+**/
+static uint64_t *pgt_next_level_table(uint64_t *table_desc, uint32_t level, uint64_t block_size)
+{
+    uint64_t *tt_base_next_level;
+    uint64_t old_desc = *table_desc;
+    uint64_t old_attrs, parent_phys_base, child_block_size, desc;
+    uint32_t i, entries;
+
+    if (IS_PGT_ENTRY_TABLE(old_desc))
+        return val_memory_phys_to_virt(old_desc & pgt_addr_mask);
+
+    tt_base_next_level = pgt_alloc_table();
+    if (tt_base_next_level == NULL) {
+        val_print(ERROR, "\n       fill_translation_table: page allocation failed     ");
+        return NULL;
+    }
+
+    /* If we are splitting an existing BLOCK descriptor into a TABLE,
+       prefill the entire child table to mirror the original mapping,
+       so that non-overlapping subranges remain mapped. */
+    if (IS_PGT_ENTRY_BLOCK(old_desc)) {
+        old_attrs = PGT_DESC_ATTRIBUTES(old_desc) & ~PGT_DESC_CONTIG;
+        parent_phys_base = old_desc & ~PGT_DESC_ATTRIBUTES_MASK & ~(block_size - 1);
+        entries = 0x1u << bits_per_level;
+        child_block_size = block_size >> bits_per_level;
+
+        desc = parent_phys_base | old_attrs | PGT_ENTRY_VALID_MASK;
+        desc |= (level + 1 == PGT_LEVEL_3) ? PGT_ENTRY_PAGE_MASK : PGT_ENTRY_BLOCK_MASK;
+
+        for (i = 0; i < entries; i++, desc += child_block_size)
+            tt_base_next_level[i] = desc;
+
+        /* The new table is not installed yet */
+        pgt_update_contig(tt_base_next_level, 0, entries - 1, level + 1);
+    }
+
+    /* The child table is complete before it is linked, so a walker sees
+       either the old block or the whole table */
+    desc = PGT_ENTRY_TABLE_MASK | PGT_ENTRY_VALID_MASK;
+    desc |= (uint64_t)val_memory_virt_to_phys(tt_base_next_level) & ~(uint64_t)(page_size - 1);
+    *table_desc = desc;
+    val_print(PGT_DEBUG_LEVEL, "\n      table_descriptor = 0x%llx     ", *table_desc);
+
+    return tt_base_next_level;
+}
+
 /**
   @brief  This API fills the translation table
 
@@ -427,19 +686,14 @@ static
 uint32_t fill_translation_table(tt_descriptor_t tt_desc, memory_region_descriptor_t *mem_desc)
 {
     uint64_t block_size = 0x1ull << tt_desc.size_log2;
-    uint64_t input_address, output_address, filled_tables, table_index;
-    uint64_t parent_block_start, parent_block_end;
-    uint64_t step_to_next_parent;
-    uint64_t *tt_base_next_level, *table_desc;
+    uint64_t index_mask = (0x1ull << tt_desc.nbits) - 1;
+    uint64_t attributes = mem_desc->attributes & ~PGT_DESC_CONTIG;
+    uint64_t input_address = tt_desc.input_base;
+    uint64_t output_address = tt_desc.output_base;
+    uint64_t first_index, table_index, last_index, block_end, desc, old_desc;
+    uint64_t *table_desc, *tt_base_next_level;
     tt_descriptor_t tt_desc_next_level;
 
-    /* Prefill support when splitting BLOCK->TABLE */
-    uint64_t old_desc, old_attrs, parent_phys_base;
-    uint64_t child_block_size, entries_to_fill, child_phys;
-    uint32_t child_level;
-    uint64_t prefill_val;
-    uint32_t i, max_entries;
-
     val_print(PGT_DEBUG_LEVEL, "\n       tt_desc.level: %d     ", tt_desc.level);
     val_print(PGT_DEBUG_LEVEL, "\n       tt_desc.input_base: 0x%llx     ", tt_desc.input_base);
     val_print(PGT_DEBUG_LEVEL, "\n       tt_desc.input_top: 0x%llx     ", tt_desc.input_top);
@@ -447,137 +701,86 @@ uint32_t fill_translation_table(tt_descriptor_t tt_desc, memory_region_descripto
     val_print(PGT_DEBUG_LEVEL, "\n       tt_desc.size_log2: %d     ", tt_desc.size_log2);
     val_print(PGT_DEBUG_LEVEL, "\n       tt_desc.nbits: %d     ", tt_desc.nbits);
 
-    if (!is_values_init) {
-        setup_acs_pgt_values();
-        is_values_init = 1;
+    /* The parent level hands down ranges within one table */
+    first_index = (input_address >> tt_desc.size_log2) & index_mask;
+    last_index = (tt_desc.input_top >> tt_desc.size_log2) & index_mask;
+    pgt_clear_contig(tt_desc.tt_base, first_index, last_index, tt_desc.level);
+
+    if (tt_desc.level == PGT_LEVEL_3)
+    {
+        desc = PGT_ENTRY_PAGE_MASK | PGT_ENTRY_VALID_MASK | attributes;
+        desc |= output_address & ~(uint64_t)(page_size - 1);
+
+        for (table_index = first_index; table_index <= last_index; table_index++) {
+            tt_desc.tt_base[table_index] = desc;
+            desc += page_size;
+        }
+
+        if (!pgt_live)
+            pgt_update_contig(tt_desc.tt_base, first_index, last_index, tt_desc.level);
+        return 0;
     }
 
-    for (input_address = tt_desc.input_base, output_address = tt_desc.output_base;
-         input_address < tt_desc.input_top;
-         input_address += (block_size - offset), output_address += (block_size - offset))
+    while (1)
     {
-        table_index = input_address >> tt_desc.size_log2 & ((0x1ull << tt_desc.nbits) - 1);
+        table_index = (input_address >> tt_desc.size_log2) & index_mask;
         table_desc = &tt_desc.tt_base[table_index];
+        block_end = input_address | (block_size - 1);
+        if (block_end > tt_desc.input_top)
+            block_end = tt_desc.input_top;
 
         val_print(PGT_DEBUG_LEVEL, "\n       table_index = %d     ", table_index);
-        /* Compute parent block bounds for this level, thereby prevent any overflows */
-        parent_block_start = (input_address & ~(block_size - 1));
-        parent_block_end   = parent_block_start + block_size - 1;
-        step_to_next_parent = (parent_block_end + 1) - input_address;
 
-        if (tt_desc.level == 3)
+        //Are input and output addresses eligible for being described via block descriptor?
+        if (pgt_block_allowed(tt_desc.level) &&
+            ((input_address | output_address) & (block_size - 1)) == 0 &&
+            block_end == (input_address + block_size - 1))
         {
-            //Create level 3 page descriptor entry
-            *table_desc = PGT_ENTRY_PAGE_MASK | PGT_ENTRY_VALID_MASK;
-            *table_desc |= (output_address & ~(uint64_t)(page_size - 1));
-            *table_desc |= mem_desc->attributes;
-            val_print(PGT_DEBUG_LEVEL, "\n       page_descriptor = 0x%llx     ", *table_desc);
-            /* Keep a count of number of L3 tables filled. If the number exceedes the limit, move
-               to next L2 table and continue.  */
-            increment_pgt_index(tt_desc.level, get_entries_per_level(page_size));
-            offset = 0;
-            continue;
-        }
+            old_desc = *table_desc;
 
-        //Are input and output addresses eligible for being described via block descriptor?
-        if ((input_address & (block_size - 1)) == 0 &&
-             (output_address & (block_size - 1)) == 0 &&
-             tt_desc.input_top >= (input_address + block_size - 1)) {
             //Create a block descriptor entry
-            *table_desc = PGT_ENTRY_BLOCK_MASK | PGT_ENTRY_VALID_MASK;
-            *table_desc |= (output_address & ~(block_size - 1));
-            *table_desc |= mem_desc->attributes;
+            desc = PGT_ENTRY_BLOCK_MASK | PGT_ENTRY_VALID_MASK;
+            desc |= (output_address & ~(block_size - 1));
+            desc |= attributes;
+            *table_desc = desc;
             val_print(PGT_DEBUG_LEVEL, "\n       block_descriptor = 0x%llx     ", *table_desc);
-            increment_pgt_index(tt_desc.level, get_entries_per_level(page_size));
-            offset = 0;
-            continue;
-        }
-        /*
-        If there's no descriptor populated at current index of this page_table, or
-        If there's a block descriptor, allocate new page, else use the already populated address.
-        Block descriptor info will be overwritten in case its there.
-        */
-        if (*table_desc == 0 || IS_PGT_ENTRY_BLOCK(*table_desc))
-        {
-            tt_base_next_level = val_memory_alloc_pages(1);
-            if (tt_base_next_level == NULL)
-            {
-                val_print(ERROR,
-                "\n       fill_translation_table: page allocation failed     ");
-                return ACS_STATUS_ERR;
-            }
-            val_memory_set(tt_base_next_level, page_size, 0);
 
-            /* If we are splitting an existing BLOCK descriptor into a TABLE,
-               prefill the entire child table to mirror the original mapping,
-               so that non-overlapping subranges remain mapped. */
-            if (*table_desc != 0 && IS_PGT_ENTRY_BLOCK(*table_desc))
-            {
-                old_desc = *table_desc;
-                old_attrs = PGT_DESC_ATTRIBUTES(old_desc);
-                parent_phys_base = old_desc & ~(block_size - 1);
-                child_level = tt_desc.level + 1;
-                child_block_size = get_block_size(child_level);
-                max_entries = get_entries_per_level(page_size);
-                /* Number of child entries covering this parent block */
-                entries_to_fill = block_size / child_block_size;
-                if (entries_to_fill > max_entries)
-                    entries_to_fill = max_entries;
-
-                for (i = 0; i < (uint32_t)entries_to_fill; ++i)
-                {
-                    child_phys = parent_phys_base + ((uint64_t)i * child_block_size);
-                    if (child_level == PGT_LEVEL_3)
-                    {
-                        prefill_val = PGT_ENTRY_PAGE_MASK | PGT_ENTRY_VALID_MASK;
-                        prefill_val |= (child_phys & ~(uint64_t)(page_size - 1));
-                        prefill_val |= old_attrs;
-                    }
-                    else
-                    {
-                        prefill_val = PGT_ENTRY_BLOCK_MASK | PGT_ENTRY_VALID_MASK;
-                        prefill_val |= (child_phys & ~(child_block_size - 1));
-                        prefill_val |= old_attrs;
-                    }
-                    tt_base_next_level[i] = prefill_val;
-                }
+            /* Release any tables the block replaces. Tables of a caller
+               supplied hierarchy may still be cached by a walker, so they are
+               left allocated. */
+            if (IS_PGT_ENTRY_TABLE(old_desc) && !pgt_live) {
+                tt_base_next_level = val_memory_phys_to_virt(old_desc & pgt_addr_mask);
+                free_translation_table(tt_base_next_level, bits_per_level, tt_desc.level + 1);
+                pgt_free_table(tt_base_next_level);
             }
         }
         else
-            tt_base_next_level = val_memory_phys_to_virt(*table_desc & pgt_addr_mask);
-
-        tt_desc_next_level.tt_base    = tt_base_next_level;
-        tt_desc_next_level.input_base = input_address;
-        filled_tables                 = get_pgt_index(tt_desc.level + 1);
-        offset                        = filled_tables * get_block_size(tt_desc.level + 1);
-
-        val_print(PGT_DEBUG_LEVEL, "       filled_tables in next level = 0x%llx", filled_tables);
-        val_print(PGT_DEBUG_LEVEL, "       offset = 0x%llx", offset);
+        {
+            tt_base_next_level = pgt_next_level_table(table_desc, tt_desc.level, block_size);
+            if (tt_base_next_level == NULL)
+                return ACS_STATUS_ERR;
 
-        tt_desc_next_level.input_top   = get_min(tt_desc.input_top, parent_block_end);
-        tt_desc_next_level.output_base = output_address;
-        tt_desc_next_level.level       = tt_desc.level + 1;
-        tt_desc_next_level.size_log2   = tt_desc.size_log2 - bits_per_level;
-        tt_desc_next_level.nbits       = bits_per_level;
-        increment_pgt_index(tt_desc.level, get_entries_per_level(page_size));
+            tt_desc_next_level.tt_base     = tt_base_next_level;
+            tt_desc_next_level.input_base  = input_address;
+            tt_desc_next_level.input_top   = block_end;
+            tt_desc_next_level.output_base = output_address;
+            tt_desc_next_level.level       = tt_desc.level + 1;
+            tt_desc_next_level.size_log2   = tt_desc.size_log2 - bits_per_level;
+            tt_desc_next_level.nbits       = bits_per_level;
 
-        if (fill_translation_table(tt_desc_next_level, mem_desc))
-        {
-            val_memory_free_pages(tt_base_next_level, 1);
-            return ACS_STATUS_ERR;
+            if (fill_translation_table(tt_desc_next_level, mem_desc))
+                return ACS_STATUS_ERR;
         }
 
-        *table_desc = PGT_ENTRY_TABLE_MASK | PGT_ENTRY_VALID_MASK;
-        *table_desc |= (uint64_t)val_memory_virt_to_phys(tt_base_next_level) &
-                       ~(uint64_t)(page_size - 1);
-        val_print(PGT_DEBUG_LEVEL, "\n      table_descriptor = 0x%llx     ", *table_desc);
+        if (block_end >= tt_desc.input_top)
+            break;
 
-        /* Ensure outer loop advances to next parent block boundary */
-        if (step_to_next_parent <= block_size)
-            offset = block_size - step_to_next_parent;
-        else
-            offset = 0;
+        output_address += (block_end + 1) - input_address;
+        input_address = block_end + 1;
     }
+
+    if (!pgt_live)
+        pgt_update_contig(tt_desc.tt_base, first_index, last_index, tt_desc.level);
     return 0;
 }
 
@@ -614,6 +817,7 @@ uint32_t val_pgt_create(memory_region_descriptor_t *mem_desc, pgt_descriptor_t *
     uint64_t *tt_base;
     tt_descriptor_t tt_desc;
     uint32_t num_pgt_levels, page_size_log2;
+    uint32_t new_table = 0;
     memory_region_descriptor_t *mem_desc_iter;
 
     page_size = val_memory_page_size();
@@ -627,16 +831,20 @@ uint32_t val_pgt_create(memory_region_descriptor_t *mem_desc, pgt_descriptor_t *
     /* check whether input page descriptor has base addr of translation table
        to use. If the pgt_base member is NULL allocate a page to create a new
        table, else update existing translation table */
+    pgt_live = 0;
     if (pgt_desc->pgt_base == (uint64_t) NULL) {
-        tt_base = (uint64_t *) val_memory_alloc_pages(1);
+        tt_base = pgt_alloc_table();
         if (tt_base == NULL) {
             val_print(ERROR, "\n      val_pgt_create: page allocation failed     ");
             return ACS_STATUS_ERR;
         }
-        val_memory_set(tt_base, page_size, 0);
+        new_table = 1;
     }
-    else
+    else {
+        /* The hierarchy may be installed, see pgt_live */
         tt_base = (uint64_t *) pgt_desc->pgt_base;
+        pgt_live = 1;
+    }
 
     tt_desc.tt_base = tt_base;
     pgt_addr_mask = ((0x1ull << (pgt_desc->ias - page_size_log2)) - 1) << page_size_log2;
@@ -645,48 +853,55 @@ uint32_t val_pgt_create(memory_region_descriptor_t *mem_desc, pgt_descriptor_t *
     {
         val_print(PGT_DEBUG_LEVEL,
                   "      val_pgt_create: input addr = 0x%x     ",
-                  mem_desc->virtual_address);
+                  mem_desc_iter->virtual_address);
         val_print(PGT_DEBUG_LEVEL,
                   "      val_pgt_create: output addr = 0x%x     ",
-                  mem_desc->physical_address);
-        val_print(PGT_DEBUG_LEVEL, "      val_pgt_create: length = 0x%x\n     ", mem_desc->length);
-        if ((mem_desc->virtual_address & (uint64_t)(page_size - 1)) != 0 ||
-            (mem_desc->physical_address & (uint64_t)(page_size - 1)) != 0)
+                  mem_desc_iter->physical_address);
+        val_print(PGT_DEBUG_LEVEL, "      val_pgt_create: length = 0x%x\n     ",
+                  mem_desc_iter->length);
+        if ((mem_desc_iter->virtual_address & (uint64_t)(page_size - 1)) != 0 ||
+            (mem_desc_iter->physical_address & (uint64_t)(page_size - 1)) != 0)
             {
                 val_print(ERROR, "\n       val_pgt_create: addr alignment err     ");
                 return ACS_STATUS_ERR;
             }
 
-        if (mem_desc->physical_address >= (0x1ull << pgt_desc->oas))
+        if (mem_desc_iter->physical_address >= (0x1ull << pgt_desc->oas))
         {
             val_print(ERROR,
                       "\n       val_pgt_create: output address size error     ");
             return ACS_STATUS_ERR;
         }
 
-        if (mem_desc->virtual_address >= (0x1ull << pgt_desc->ias))
+        if (mem_desc_iter->virtual_address >= (0x1ull << pgt_desc->ias))
         {
             val_print(WARN,
                       "\n       val_pgt_create: input address size error, "
                       "truncating to %d-bits     ",
                       pgt_desc->ias);
-            mem_desc->virtual_address &= ((0x1ull << pgt_desc->ias) - 1);
+            mem_desc_iter->virtual_address &= ((0x1ull << pgt_desc->ias) - 1);
         }
 
-        tt_desc.input_base = mem_desc->virtual_address & ((0x1ull << pgt_desc->ias) - 1);
-        tt_desc.input_top = tt_desc.input_base + mem_desc->length - 1;
-        tt_desc.output_base = mem_desc->physical_address & ((0x1ull << pgt_desc->oas) - 1);
+        tt_desc.input_base = mem_desc_iter->virtual_address & ((0x1ull << pgt_desc->ias) - 1);
+        tt_desc.input_top = tt_desc.input_base + mem_desc_iter->length - 1;
+        tt_desc.output_base = mem_desc_iter->physical_address & ((0x1ull << pgt_desc->oas) - 1);
         tt_desc.level = 4 - num_pgt_levels;
         tt_desc.size_log2 = (num_pgt_levels - 1) * bits_per_level + page_size_log2;
         tt_desc.nbits = pgt_desc->ias - tt_desc.size_log2;
 
-        if (fill_translation_table(tt_desc, mem_desc))
+        if (fill_translation_table(tt_desc, mem_desc_iter))
         {
-            val_memory_free_pages(tt_base, 1);
+            /* Tables linked into a caller supplied hierarchy stay in place */
+            if (new_table) {
+                free_translation_table(tt_base, tt_desc.nbits, tt_desc.level);
+                pgt_free_table(tt_base);
+            }
+            pgt_live = 0;
             return ACS_STATUS_ERR;
         }
     }
 
+    pgt_live = 0;
     pgt_desc->pgt_base = (uint64_t)val_memory_virt_to_phys(tt_base);
 
     return 0;
@@ -744,11 +959,11 @@ uint64_t val_pgt_get_attributes(pgt_descriptor_t pgt_desc, uint64_t virtual_addr
         {
             if (!IS_PGT_ENTRY_PAGE(val64))
                 return ACS_STATUS_ERR;
-            *attributes = PGT_DESC_ATTRIBUTES(val64);
+            *attributes = PGT_DESC_ATTRIBUTES(val64) & ~PGT_DESC_CONTIG;
             return 0;
         }
         if (IS_PGT_ENTRY_BLOCK(val64)) {
-            *attributes = PGT_DESC_ATTRIBUTES(val64);
+            *attributes = PGT_DESC_ATTRIBUTES(val64) & ~PGT_DESC_CONTIG;
             return 0;
         }
         tt_base_phys = val64 & (((0x1ull << (ias - page_size_log2)) - 1) << page_size_log2);
@@ -788,7 +1003,7 @@ static void free_translation_table(uint64_t *tt_base, uint32_t bits_at_this_leve
             val_print(PGT_DEBUG_LEVEL,
                       "\n       free_translation_table: tt_base_next_virt = %llx     ",
                       (uint64_t)tt_base_next_virt);
-            val_memory_free_pages(tt_base_next_virt, 1);
+            pgt_free_table(tt_base_next_virt);
         }
     }
 }
@@ -816,5 +1031,5 @@ void val_pgt_destroy(pgt_descriptor_t pgt_desc)
     free_translation_table(pgt_base_virt,
                            pgt_desc.ias - ((num_pgt_levels - 1) * bits_per_level + page_size_log2),
                            4 - num_pgt_levels);
-    val_memory_free_pages(pgt_base_virt, 1);
+    pgt_free_table(pgt_base_virt);
 }
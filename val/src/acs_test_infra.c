@@ -18,13 +18,20 @@
 #include "acs_val.h"
 #include "acs_pe.h"
 #include "acs_common.h"
+#include "acs_std_smc.h"
 #include "acs_exception.h"
 #include "pal_interface.h"
 #include "val_interface.h"
 #include "val_status.h"
+#include "acs_memory.h"
 
 uint32_t g_override_skip;
 static acs_test_status_counters_t g_rule_test_stats;
+
+/* Fan-out latency totals for the summary, see val_run_test_payload_fanout() */
+static uint32_t g_fanout_count;
+static uint64_t g_fanout_total_ticks;
+static uint64_t g_fanout_max_ticks;
 /**
   @brief  Print standardized log context prefix.
           1. Caller       - Application/VAL layers
@@ -148,6 +155,7 @@ void
 val_print_acs_test_status_summary(void)
 {
   acs_test_status_counters_t *stats = acs_get_test_status();
+  uint64_t freq;
 
   val_print(INFO, "\n---------- ACS Summary ----------\n");
   val_print(INFO, "   Total Rules Run        : %d\n",
@@ -162,6 +170,17 @@ val_print_acs_test_status_summary(void)
             stats->pal_not_supported);
   val_print(INFO, "   Test Not Implemented   : %d\n",
             stats->not_implemented);
+
+  if (g_fanout_count) {
+      freq = val_get_counter_frequency();
+      if (freq) {
+          val_print(INFO, "   PE Fan-out Tests       : %d\n", g_fanout_count);
+          val_print(INFO, "   PE Fan-out Avg (us)    : %d\n",
+                    (g_fanout_total_ticks / g_fanout_count) * 1000000 / freq);
+          val_print(INFO, "   PE Fan-out Max (us)    : %d\n",
+                    g_fanout_max_ticks * 1000000 / freq);
+      }
+  }
   val_print(INFO, "---------------------------------\n");
 
 }
@@ -394,6 +413,10 @@ val_initialize_test(uint32_t test_num, char8_t *desc, uint32_t num_pe)
 
   g_override_skip = 0;
 
+  /* Memory allocated by the test is freed in val_check_for_error */
+  if (acs_policy_get_heap_test_arena())
+      val_memory_arena_open();
+
   for (i = 0; i < num_pe; i++)
       val_set_status(i, RESULT_PENDING(test_num));
 
@@ -438,22 +461,104 @@ val_initialize_test(uint32_t test_num, char8_t *desc, uint32_t num_pe)
   return ACS_STATUS_PASS;
 }
 #else
+/**
+  @brief  Whether a single PE test runs on a secondary PE, dispatched there by
+          the parallel rule scheduler. Such a test runs only its body: the heap
+          test arena, the exception handler and the checkpoint print are shared
+          state left to the primary PE.
+
+  @param num_pe  Number of PEs executing the test.
+
+  @return 1 if the test was dispatched to a secondary PE, 0 otherwise.
+ **/
+static uint32_t
+val_test_is_dispatched(uint32_t num_pe)
+{
+  return (num_pe == 1) &&
+         (val_pe_get_index_mpid(val_pe_get_mpid()) != val_pe_get_primary_index());
+}
+
 uint32_t
 val_initialize_test(uint32_t test_num, char8_t *desc, uint32_t num_pe)
 {
   uint32_t i;
   (void)desc;
-  (void)num_pe;
 
-  /* Set TEST_PENDING_VAL status for all PEs, hint for val_wait_for_test_completion */
-  for (i = 0; i < num_pe; i++)
-      val_set_status(i, RESULT_PENDING(test_num));
+  if (val_test_is_dispatched(num_pe)) {
+      val_set_status(val_pe_get_index_mpid(val_pe_get_mpid()), RESULT_PENDING(test_num));
+      return ACS_STATUS_PASS;
+  }
+
+  /* Memory allocated by the test is freed in val_check_for_error */
+  if (acs_policy_get_heap_test_arena())
+      val_memory_arena_open();
+
+  /* Single PE tests only use the slot of the running PE, which need not be the
+     first entry of pe_info_table (see val_check_for_error) */
+  if (num_pe == 1) {
+      val_set_status(val_pe_get_index_mpid(val_pe_get_mpid()), RESULT_PENDING(test_num));
+  } else {
+      /* Set TEST_PENDING_VAL status for all PEs, hint for val_wait_for_test_completion */
+      for (i = 0; i < num_pe; i++)
+          val_set_status(i, RESULT_PENDING(test_num));
+  }
 
   val_pe_initialize_default_exception_handler(val_pe_default_esr);
   return ACS_STATUS_PASS;
 }
 #endif /* COMPILE_RB_EXE */
 
+/* Each PE has its mailbox and status in a slot of its own, a cache
+   writeback granule in size, so updates from different PEs never share a
+   line. The pending bitmap follows the last slot. */
+typedef struct {
+  VAL_SHARED_MEM_t  mailbox;
+  val_test_status_t status;
+  uint64_t          woken_at;   /* System counter when woken by a fan-out */
+  uint32_t          pool_state; /* POOL_PE_* state of a worker pool PE */
+  uint32_t          doorbell;   /* POOL_DOORBELL_* request to a parked PE */
+} VAL_PE_SLOT_t;
+
+/* Worker pool state of a secondary PE, see val_pe_pool_park() */
+#define POOL_PE_OFF         0
+#define POOL_PE_BUSY        1
+#define POOL_PE_PARKED      2
+
+#define POOL_DOORBELL_NONE  0
+#define POOL_DOORBELL_RUN   1
+#define POOL_DOORBELL_OFF   2
+
+/* Set while a test needs the secondary PEs to be powered on and off */
+static uint32_t g_pe_pool_legacy;
+
+/* Largest writeback granule, assumed when CTR_EL0.CWG gives no information */
+#define CWG_MAX_BYTES  2048
+
+/**
+  @brief  Size of a PE slot in shared memory, the cache writeback granule.
+**/
+static uint32_t
+val_shared_slot_size(void)
+{
+  uint32_t cwg = (val_pe_reg_read(CTR_EL0) >> 24) & 0xF;
+  uint32_t size = cwg ? (4u << cwg) : CWG_MAX_BYTES;
+
+  while (size < sizeof(VAL_PE_SLOT_t))
+      size <<= 1;
+
+  return size;
+}
+
+static VAL_PE_SLOT_t *
+val_get_pe_slot(uint32_t index)
+{
+  uint32_t slot_size = val_shared_slot_size();
+  uintptr_t base = (uintptr_t)pal_mem_get_shared_addr();
+
+  base = (base + slot_size - 1) & ~((uintptr_t)slot_size - 1);
+  return (VAL_PE_SLOT_t *)(base + (uintptr_t)index * slot_size);
+}
+
 /**
   @brief  Allocate memory which is to be shared across PEs
 
@@ -465,23 +570,72 @@ void
 val_allocate_shared_mem()
 {
   uint32_t num_pe = val_pe_get_num();
+  uint32_t slot_size = val_shared_slot_size();
+  uint32_t bitmap_size = sizeof(uint64_t) + ((num_pe + 63) / 64) * sizeof(uint64_t);
+  volatile uint64_t *pending;
+  VAL_PE_SLOT_t *slot;
+  uint32_t i;
 
+  /* One slot of slack to align the first slot, then the PE slots and the
+     pending count followed by the pending bitmap */
   uint32_t total_size =
-        (num_pe * sizeof(VAL_SHARED_MEM_t)) +
-        (num_pe * sizeof(val_test_status_t));
+        slot_size + (num_pe * slot_size) +
+        ((bitmap_size + slot_size - 1) & ~(slot_size - 1));
 
   pal_mem_allocate_shared(1, total_size);
+  if (pal_mem_get_shared_addr() == 0)
+      return;
+
+  pending = (volatile uint64_t *)val_get_pending_count();
+  for (i = 0; i < bitmap_size / sizeof(uint64_t); i++) {
+      pending[i] = 0;
+      val_data_cache_ops_by_va((addr_t)&pending[i], CLEAN_AND_INVALIDATE);
+  }
+
+  for (i = 0; i < num_pe; i++) {
+      slot = val_get_pe_slot(i);
+      slot->pool_state = POOL_PE_OFF;
+      slot->doorbell = POOL_DOORBELL_NONE;
+      val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+  }
+}
 
+/**
+  @brief  Return the address of the status record of a PE in shared memory.
+
+  @param  index  PE index.
+
+  @result Address of the val_test_status_t record.
+**/
+uintptr_t val_get_status_slot(uint32_t index)
+{
+    return (uintptr_t)&val_get_pe_slot(index)->status;
 }
 
-uintptr_t val_get_status_region_base(void)
+/**
+  @brief  Return the number of PEs whose status is pending. It starts the
+          line after the last PE slot, followed by the pending bitmap.
+
+  @param  None
+
+  @result Address of the 64-bit count.
+**/
+volatile uint64_t *val_get_pending_count(void)
 {
-    uintptr_t base = (uintptr_t)pal_mem_get_shared_addr();
-    uint32_t npe = val_pe_get_num();
+    return (volatile uint64_t *)val_get_pe_slot(val_pe_get_num());
+}
 
-    /* Status region starts after ACS data region */
-    base += (uintptr_t)(npe * sizeof(VAL_SHARED_MEM_t));
-    return base;
+/**
+  @brief  Return the bitmap of PEs whose status is pending, bit n of the
+          bitmap is PE index n.
+
+  @param  None
+
+  @result Address of the first 64-bit word of the bitmap.
+**/
+volatile uint64_t *val_get_pending_bitmap(void)
+{
+    return val_get_pending_count() + 1;
 }
 
 /**
@@ -497,6 +651,8 @@ void
 val_free_shared_mem()
 {
 
+  /* Parked PEs poll their slot */
+  val_pe_pool_drain();
   pal_mem_free_shared();
 }
 
@@ -524,8 +680,7 @@ val_set_test_data(uint32_t index, uint64_t addr, uint64_t test_data)
       return;
   }
 
-  mem = (VAL_SHARED_MEM_t *)pal_mem_get_shared_addr();
-  mem = mem + index;
+  mem = &val_get_pe_slot(index)->mailbox;
 
   mem->data0 = addr;
   mem->data1 = test_data;
@@ -559,8 +714,7 @@ val_get_test_data(uint32_t index, uint64_t *data0, uint64_t *data1)
       return;
   }
 
-  mem = (VAL_SHARED_MEM_t *) pal_mem_get_shared_addr();
-  mem = mem + index;
+  mem = &val_get_pe_slot(index)->mailbox;
 
   val_data_cache_ops_by_va((addr_t)&mem->data0, INVALIDATE);
   val_data_cache_ops_by_va((addr_t)&mem->data1, INVALIDATE);
@@ -570,15 +724,322 @@ val_get_test_data(uint32_t index, uint64_t *data0, uint64_t *data1)
 
 }
 
+/**
+  @brief  Whether secondary PEs park after their payload instead of powering
+          off. Set by the pe_worker_pool policy unless a test asked for the
+          legacy path with val_pe_pool_set_legacy().
+
+  @return 1 if the worker pool is in use, 0 otherwise.
+ **/
+uint32_t
+val_pe_pool_enabled(void)
+{
+  val_data_cache_ops_by_va((addr_t)&g_pe_pool_legacy, INVALIDATE);
+  return acs_policy_get_pe_worker_pool() && !g_pe_pool_legacy;
+}
+
+/**
+  @brief  Park the running secondary PE once its payload is done. The PE
+          waits in WFE for its doorbell and runs the payload posted in its
+          mailbox, until it is asked to power off or the pool is no longer
+          in use.
+          1. Caller       - val_test_entry()
+
+  @return None, returns when the PE is to be powered off.
+ **/
+void
+val_pe_pool_park(void)
+{
+  uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
+  volatile VAL_PE_SLOT_t *slot = val_get_pe_slot(index);
+  void (*vector)(uint64_t args);
+  uint64_t test_arg;
+  uint32_t doorbell;
+
+  if (!acs_policy_get_pe_worker_pool())
+      return;
+
+  while (val_pe_pool_enabled()) {
+      slot->pool_state = POOL_PE_PARKED;
+      val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+
+      /* A SEV sent before the WFE is latched in the event register */
+      while (1) {
+          val_data_cache_ops_by_va((addr_t)slot, INVALIDATE);
+          doorbell = slot->doorbell;
+          if (doorbell != POOL_DOORBELL_NONE)
+              break;
+          wfe();
+      }
+
+      slot->doorbell = POOL_DOORBELL_NONE;
+      if (doorbell == POOL_DOORBELL_OFF)
+          break;
+      val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+
+      val_get_test_data(index, (uint64_t *)&vector, &test_arg);
+      vector(test_arg);
+  }
+
+  slot->pool_state = POOL_PE_OFF;
+  val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+}
+
+/**
+  @brief  Ring the doorbell of a parked PE.
+
+  @return None
+ **/
+static void
+val_pe_pool_ring(volatile VAL_PE_SLOT_t *slot, uint32_t doorbell)
+{
+  slot->pool_state = POOL_PE_BUSY;
+  slot->doorbell = doorbell;
+  val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+  dsbish();
+  sev();
+}
+
+/**
+  @brief  Wait until a worker pool PE is no longer busy with a payload.
+
+  @return POOL_PE_* state of the PE.
+ **/
+static uint32_t
+val_pe_pool_wait_idle(volatile VAL_PE_SLOT_t *slot)
+{
+  uint32_t timeout = TIMEOUT_LARGE;
+
+  do {
+      val_data_cache_ops_by_va((addr_t)slot, INVALIDATE);
+  } while (slot->pool_state == POOL_PE_BUSY && --timeout);
+
+  return slot->pool_state;
+}
+
+/**
+  @brief  Run the payload already written to the mailbox of a PE on it, if
+          it is parked in the worker pool.
+          1. Caller       - val_execute_on_pe() and the payload fan-out
+          2. Prerequisite - val_set_test_data
+
+  @param index  PE index.
+
+  @return ACS_STATUS_PASS if the payload was posted to the parked PE,
+          ACS_STATUS_SKIP if the PE stayed busy with an earlier payload,
+          ACS_STATUS_ERR if the PE has to be started with PSCI CPU_ON.
+          When the pool is in use, the PE is then marked busy so it parks
+          after the payload, val_pe_pool_start_failed() undoes this.
+ **/
+uint32_t
+val_pe_pool_post(uint32_t index)
+{
+  volatile VAL_PE_SLOT_t *slot;
+  uint32_t state;
+
+  if (!val_pe_pool_enabled())
+      return ACS_STATUS_ERR;
+
+  slot = val_get_pe_slot(index);
+  state = val_pe_pool_wait_idle(slot);
+
+  if (state == POOL_PE_PARKED) {
+      val_pe_pool_ring(slot, POOL_DOORBELL_RUN);
+      return ACS_STATUS_PASS;
+  }
+
+  if (state == POOL_PE_BUSY)
+      return ACS_STATUS_SKIP;
+
+  slot->pool_state = POOL_PE_BUSY;
+  val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+  return ACS_STATUS_ERR;
+}
+
+/**
+  @brief  Mark a PE as off after PSCI CPU_ON failed to start it.
+
+  @param index  PE index.
+
+  @return None
+ **/
+void
+val_pe_pool_start_failed(uint32_t index)
+{
+  volatile VAL_PE_SLOT_t *slot;
+
+  if (!val_pe_pool_enabled())
+      return;
+
+  slot = val_get_pe_slot(index);
+  slot->pool_state = POOL_PE_OFF;
+  val_data_cache_ops_by_va((addr_t)slot, CLEAN_AND_INVALIDATE);
+}
+
+/**
+  @brief  Power off every PE parked in the worker pool. A PE busy with a
+          payload is given TIMEOUT_LARGE to finish first.
+
+  @return None
+ **/
+void
+val_pe_pool_drain(void)
+{
+  uint32_t my_index, num_pe, i;
+  volatile VAL_PE_SLOT_t *slot;
+
+  if (!acs_policy_get_pe_worker_pool() || pal_mem_get_shared_addr() == 0)
+      return;
+
+  my_index = val_pe_get_index_mpid(val_pe_get_mpid());
+  num_pe = val_pe_get_num();
+
+  for (i = 0; i < num_pe; i++) {
+      if (i == my_index)
+          continue;
+
+      slot = val_get_pe_slot(i);
+      if (val_pe_pool_wait_idle(slot) == POOL_PE_PARKED)
+          val_pe_pool_ring(slot, POOL_DOORBELL_OFF);
+  }
+
+  /* A PE marks itself off just before PSCI CPU_OFF, val_execute_on_pe()
+     retries CPU_ON while it is still on */
+  for (i = 0; i < num_pe; i++) {
+      if (i != my_index)
+          val_pe_pool_wait_idle(val_get_pe_slot(i));
+  }
+}
+
+/**
+  @brief  Request the legacy PSCI CPU_ON/CPU_OFF path for tests which need
+          the secondary PEs to be power cycled, parked PEs are powered off.
+          1. Caller       - Test Suite
+
+  @param legacy  1 to power cycle the PEs for every payload, 0 to return
+                 to the worker pool when the pe_worker_pool policy is set.
+
+  @return None
+ **/
+void
+val_pe_pool_set_legacy(uint32_t legacy)
+{
+  if (legacy)
+      val_pe_pool_drain();
+
+  g_pe_pool_legacy = legacy;
+  val_data_cache_ops_by_va((addr_t)&g_pe_pool_legacy, CLEAN_AND_INVALIDATE);
+}
+
+/* Event stream used to bound the WFE sleep of the completion wait */
+#define CNTCTL_EVNTEN           (1ull << 2)
+#define CNTCTL_EVNTI_SHIFT      4
+#define CNTCTL_EVNTI_MASK       (0xFull << CNTCTL_EVNTI_SHIFT)
+#define COMPLETION_EVENT_HZ     10000
+
+/* Time limit of the completion wait when the counter frequency is known. It
+   does not scale with the TIMEOUT_* iteration counts, which platforms size
+   for polling loops. */
+#ifdef PLATFORM_OVERRIDE_COMPLETION_TIMEOUT_US
+#define COMPLETION_TIMEOUT_US  PLATFORM_OVERRIDE_COMPLETION_TIMEOUT_US
+#else
+#define COMPLETION_TIMEOUT_US  10000000   /* 10 seconds */
+#endif
+
+/**
+  @brief  Find the highest PE index below num_pe whose status is pending.
+
+  @param num_pe  Number of PEs executing the test.
+
+  @return  Index of that PE plus one, 0 if none is pending.
+ **/
+static uint32_t
+val_last_pending_pe(uint32_t num_pe)
+{
+  volatile uint64_t *pending = val_get_pending_bitmap();
+  uint32_t num_words = (num_pe + 63) / 64;
+  uint32_t words_per_line;
+  uint32_t i, last = 0;
+  uint64_t word;
+
+  /* The bitmap is refetched one cache line at a time */
+  words_per_line = (4u << ((val_pe_reg_read(CTR_EL0) >> 16) & 0xF)) / sizeof(uint64_t);
+
+  for (i = 0; i < num_words; i++)
+  {
+      if ((i % words_per_line) == 0)
+          val_data_cache_ops_by_va((addr_t)&pending[i], INVALIDATE);
+
+      word = pending[i];
+      if ((i == num_words - 1) && (num_pe % 64))
+          word &= (1ull << (num_pe % 64)) - 1;
+
+      if (word)
+          last = (i * 64) + (64 - __builtin_clzll(word));
+  }
+
+  return last;
+}
+
+/**
+  @brief  Turn on the generic timer event stream of this PE, so WFE wakes up
+          at least every 1/COMPLETION_EVENT_HZ seconds.
+
+  @param freq  System counter frequency.
+
+  @return  Previous value of the timer control register, for restoring.
+ **/
+static uint64_t
+val_event_stream_enable(uint64_t freq)
+{
+  uint64_t period = freq / COMPLETION_EVENT_HZ;
+  uint64_t ctl, evnti = 0;
+  uint32_t el2 = (val_pe_reg_read(CurrentEL) == AARCH64_EL2);
+
+  /* An event is generated every 2^(EVNTI + 1) counter ticks */
+  while ((evnti < 15) && ((2ull << (evnti + 1)) <= period))
+      evnti++;
+
+  ctl = el2 ? read_cnthctl_el2() : read_cntkctl_el1();
+
+  if (el2)
+      write_cnthctl_el2((ctl & ~CNTCTL_EVNTI_MASK) | (evnti << CNTCTL_EVNTI_SHIFT) |
+                        CNTCTL_EVNTEN);
+  else
+      write_cntkctl_el1((ctl & ~CNTCTL_EVNTI_MASK) | (evnti << CNTCTL_EVNTI_SHIFT) |
+                        CNTCTL_EVNTEN);
+  isb();
+
+  return ctl;
+}
+
+static void
+val_event_stream_restore(uint64_t ctl)
+{
+  if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+      write_cnthctl_el2(ctl);
+  else
+      write_cntkctl_el1(ctl);
+  isb();
+}
+
 /**
   @brief  This function will wait for all PEs to report their status
           or we timeout and set a failure for the PE which timed-out
           1. Caller       - Application layer
           2. Prerequisite - val_set_status
 
+          The PE sleeps in WFE until the PE which brings the pending count to
+          zero issues SEV. The timer event stream bounds each sleep, so the
+          wait ends after COMPLETION_TIMEOUT_US even if no PE reports. Only if
+          the counter frequency is unknown is timeout used, as an iteration
+          count. On a timeout the pending bits of the PEs of this test are
+          cleared so that they do not carry over to the next test.
+
   @param test_num  Unique test number
   @param num_pe    Number of PE who are executing this test
-  @param timeout   integer value ob expiry the API will timeout and return
+  @param timeout   iteration count after which the API times out, used only
+                   when the counter frequency is unknown
 
   @return        None
  **/
@@ -587,7 +1048,9 @@ static void
 val_wait_for_test_completion(uint32_t test_num, uint32_t num_pe, uint32_t timeout)
 {
 
-  uint32_t i = 0, j = 0;
+  volatile uint64_t *count = val_get_pending_count();
+  uint64_t freq, deadline, ctl;
+  uint32_t j = 0;
 
   val_print(TRACE, "Test_num= %d\n", test_num);
 
@@ -595,21 +1058,199 @@ val_wait_for_test_completion(uint32_t test_num, uint32_t num_pe, uint32_t timeou
   if (num_pe == 1)
       return;
 
-  while(--timeout)
-  {
-      j = 0;
-      for (i = 0; i < num_pe; i++)
-      {
-          if (IS_RESULT_PENDING(val_get_status(i))) {
-              j = i+1;
-          }
+  freq = val_get_counter_frequency();
+  if (freq == 0) {
+      while (--timeout) {
+          j = val_last_pending_pe(num_pe);
+          //If None of the PE have the status as Pending, return
+          if (!j)
+              return;
+      }
+  } else {
+      deadline = syscounter_read() + val_get_timeout_to_ticks(COMPLETION_TIMEOUT_US);
+      ctl = val_event_stream_enable(freq);
+
+      while (1) {
+          /* The count also covers PEs beyond num_pe, so only a non-zero count
+             needs the bitmap to be checked */
+          val_data_cache_ops_by_va((addr_t)count, INVALIDATE);
+          j = (__atomic_load_n(count, __ATOMIC_ACQUIRE) == 0) ? 0 : val_last_pending_pe(num_pe);
+          if (!j || (syscounter_read() >= deadline))
+              break;
+          wfe();
       }
-      //If None of the PE have the status as Pending, return
+
+      val_event_stream_restore(ctl);
       if (!j)
           return;
   }
   //We are here if we timed-out, set the last index PE as failed
   val_set_status(j-1, RESULT_FAIL(0xF));
+  val_reset_pending(num_pe);
+}
+
+/* Each PE woken by a fan-out wakes up to this many further PEs */
+#define FANOUT_DEGREE  4
+
+/* Fan-out of the running multi-PE test. The secondary PEs, other than the
+   root, are placed in a FANOUT_DEGREE-ary tree by their position in PE index
+   order with the root skipped. Node 0 is the root, node n + 1 the PE at
+   position n. */
+static struct {
+  void     (*payload)(void);
+  uint32_t root;
+  uint32_t num_pe;
+} g_fanout __attribute__((aligned(64)));
+
+static uint32_t
+val_fanout_index(uint32_t pos)
+{
+  return (pos < g_fanout.root) ? pos : pos + 1;
+}
+
+static void val_fanout_wake_children(uint32_t node);
+
+/**
+  @brief  Wake the PE at a fan-out position, by its worker pool doorbell if
+          it is parked and with PSCI CPU_ON otherwise. If it does not start,
+          its status is set like val_execute_on_pe() does and its children
+          are woken in its place.
+
+  @param pos  Position of the PE in the fan-out.
+
+  @return None
+ **/
+static void
+val_fanout_wake(uint32_t pos)
+{
+  ARM_SMC_ARGS smc_args = {0};
+  uint32_t index = val_fanout_index(pos);
+  int timeout = TIMEOUT_LARGE;
+  uint32_t status;
+
+  status = val_pe_pool_post(index);
+  if (status == ACS_STATUS_PASS)
+      return;
+
+  if (status == ACS_STATUS_SKIP) {
+      val_print(WARN, "\n       WARNING: Skipping test for PE index %d "
+                              "since it is still busy\n", index);
+      val_set_status(index, RESULT_SKIP(0x120 - (int)ARM_SMC_PSCI_RET_ALREADY_ON));
+      val_fanout_wake_children(pos + 1);
+      return;
+  }
+
+  do {
+      smc_args.Arg0 = ARM_SMC_ID_PSCI_CPU_ON_AARCH64;
+      smc_args.Arg1 = val_pe_get_mpid_index(index);
+      pal_pe_execute_payload(&smc_args);
+  } while (smc_args.Arg0 == (uint64_t)ARM_SMC_PSCI_RET_ALREADY_ON && timeout--);
+
+  if (smc_args.Arg0 == 0)
+      return;
+
+  val_pe_pool_start_failed(index);
+
+  if (smc_args.Arg0 == (uint64_t)ARM_SMC_PSCI_RET_ALREADY_ON) {
+      val_print(WARN, "\n       WARNING: Skipping test for PE index %d "
+                              "since it is already on\n", index);
+      val_set_status(index, RESULT_SKIP(0x120 - (int)smc_args.Arg0));
+  } else {
+      val_print(ERROR, "\n       PSCI_CPU_ON: failure[%d]", smc_args.Arg0);
+      val_set_status(index, RESULT_FAIL(0x120 - (int)smc_args.Arg0));
+  }
+
+  val_fanout_wake_children(pos + 1);
+}
+
+static void
+val_fanout_wake_children(uint32_t node)
+{
+  uint32_t child;
+
+  for (child = node * FANOUT_DEGREE;
+       child < (node + 1) * FANOUT_DEGREE && child < g_fanout.num_pe - 1; child++)
+      val_fanout_wake(child);
+}
+
+/**
+  @brief  Entry of a PE woken by a fan-out, run through val_test_entry().
+          Records the wake time, wakes the children of the PE and runs the
+          payload of the test.
+
+  @return None
+ **/
+static void
+val_fanout_entry(void)
+{
+  uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
+  VAL_PE_SLOT_t *slot = val_get_pe_slot(index);
+
+  slot->woken_at = syscounter_read();
+  val_data_cache_ops_by_va((addr_t)&slot->woken_at, CLEAN_AND_INVALIDATE);
+
+  val_data_cache_ops_by_va((addr_t)&g_fanout, INVALIDATE);
+  val_fanout_wake_children(((index < g_fanout.root) ? index : index - 1) + 1);
+
+  g_fanout.payload();
+}
+
+/**
+  @brief  Run a multi-PE payload with a tree fan-out. All mailboxes are
+          written first, the primary PE wakes the first FANOUT_DEGREE PEs
+          and runs its payload while the woken PEs wake the rest.
+
+  @return None
+ **/
+static void
+val_run_test_payload_fanout(uint32_t test_num, uint32_t num_pe, void (*payload)(void),
+                            uint64_t test_input, uint32_t my_index)
+{
+  uint64_t start, last = 0;
+  uint32_t i;
+  VAL_PE_SLOT_t *slot;
+
+  g_fanout.payload = payload;
+  g_fanout.root = my_index;
+  g_fanout.num_pe = num_pe;
+  val_data_cache_ops_by_va((addr_t)&g_fanout, CLEAN_AND_INVALIDATE);
+
+  for (i = 0; i < num_pe; i++) {
+      if (i == my_index)
+          continue;
+
+      slot = val_get_pe_slot(i);
+      slot->woken_at = 0;
+      val_data_cache_ops_by_va((addr_t)&slot->woken_at, CLEAN_AND_INVALIDATE);
+      val_set_test_data(i, (uint64_t)val_fanout_entry, test_input);
+  }
+
+  start = syscounter_read();
+  val_fanout_wake_children(0);
+
+  payload();
+
+  val_wait_for_test_completion(test_num, num_pe, TIMEOUT_LARGE);
+
+  /* Latency until the last PE was running */
+  for (i = 0; i < num_pe; i++) {
+      if (i == my_index)
+          continue;
+
+      slot = val_get_pe_slot(i);
+      val_data_cache_ops_by_va((addr_t)&slot->woken_at, INVALIDATE);
+      if (slot->woken_at > last)
+          last = slot->woken_at;
+  }
+
+  if (last > start) {
+      g_fanout_count++;
+      g_fanout_total_ticks += last - start;
+      if (last - start > g_fanout_max_ticks)
+          g_fanout_max_ticks = last - start;
+      val_print(DEBUG, "\n       Fan-out to %d PEs", num_pe - 1);
+      val_print(DEBUG, " took %d ticks", last - start);
+  }
 }
 
 /**
@@ -631,6 +1272,11 @@ val_run_test_payload(uint32_t test_num, uint32_t num_pe, void (*payload)(void),
   uint32_t my_index = val_pe_get_index_mpid(val_pe_get_mpid());
   uint32_t i;
 
+  if (num_pe > 1 && acs_policy_get_pe_fanout()) {
+      val_run_test_payload_fanout(test_num, num_pe, payload, test_input, my_index);
+      return;
+  }
+
   payload();  //this is test run separately on present PE
   if (num_pe == 1)
       return;
@@ -687,6 +1333,10 @@ val_check_for_error(uint32_t test_num, uint32_t num_pe, char8_t *ruleid)
   uint32_t my_index = val_pe_get_index_mpid(val_pe_get_mpid());
   (void) test_num;
 
+  /* The test has completed, free the memory it allocated */
+  if (acs_policy_get_heap_test_arena())
+      val_memory_arena_release();
+
   /* this special case is needed when the Main PE is not the first entry
      of pe_info_table but num_pe is 1 for SOC tests */
   if (num_pe == 1) {
@@ -735,11 +1385,19 @@ val_check_for_error(uint32_t test_num, uint32_t num_pe, char8_t *ruleid)
   (void)ruleid;
   (void)test_num;
 
-  uint32_t i, checkpoint;
+  uint32_t i;
   uint32_t overall_status;
   uint32_t status = RESULT_FAIL(0);
   uint32_t my_index = val_pe_get_index_mpid(val_pe_get_mpid());
 
+  /* The primary PE prints the checkpoint when it reports the rule */
+  if (val_test_is_dispatched(num_pe))
+      return val_get_status(my_index);
+
+  /* The test has completed, free the memory it allocated */
+  if (acs_policy_get_heap_test_arena())
+      val_memory_arena_release();
+
   if (num_pe == 1) {
       status = val_get_status(my_index);
       overall_status = status;
@@ -758,17 +1416,31 @@ val_check_for_error(uint32_t test_num, uint32_t num_pe, char8_t *ruleid)
       }
   }
 
-  checkpoint = (uint32_t)GET_CODE(overall_status);
-  if (GET_STATE(overall_status) == TEST_FAIL) {
+  val_print_checkpoint(overall_status);
+
+  return overall_status;
+}
+
+/**
+  @brief  Prints the checkpoint of a failed, skipped or warned test status.
+          1. Caller       - val_check_for_error, rule orchestrator
+
+  @param status  Overall status of the test
+
+  @return None
+ **/
+void
+val_print_checkpoint(uint32_t status)
+{
+  uint32_t checkpoint = (uint32_t)GET_CODE(status);
+
+  if (GET_STATE(status) == TEST_FAIL) {
       val_print(ERROR, "\nFailed at checkpoint - %2d", checkpoint);
-  } else if (GET_STATE(overall_status) == TEST_SKIP) {
+  } else if (GET_STATE(status) == TEST_SKIP) {
       val_print(ERROR, "\nSkipped at checkpoint - %2d", checkpoint);
-  } else if (GET_STATE(overall_status) == TEST_WARNING) {
+  } else if (GET_STATE(status) == TEST_WARNING) {
       val_print(WARN, "\ncheckpoint - %2d", checkpoint);
   }
-
-
-  return overall_status;
 }
 #endif
 /**
@@ -181,7 +181,7 @@ print_rule_test_start(uint32_t rule_enum, uint32_t indent)
     val_print(INFO, " : ");
     /* Print rule  description */
     if (rule_test_map[rule_enum].flag != INVALID_ENTRY) {
-        val_print(INFO, rule_test_map[rule_enum].rule_desc);
+        val_print(INFO, rule_desc_string[rule_enum] ? rule_desc_string[rule_enum] : "");
     }
 }
 
@@ -314,12 +314,38 @@ void rule_status_map_reset(void)
     }
 }
 
+/**
+ * @brief Record the alias_rule_map index of every alias rule.
+ *
+ * Stores the index of each `alias_rule_map` entry in the `alias_idx` field of
+ * its alias rule (first entry wins), so that `alias_rule_map_get_index` is a
+ * direct index into `rule_test_map`. Must be called on the primary PE before
+ * any lookup, run_tests() does so before dispatching rules. Later calls return
+ * without rewriting the table.
+ */
+void
+alias_rule_map_build_index(void)
+{
+    static bool alias_idx_ready;
+    uint32_t i;
+    RULE_ID_e rid;
+
+    if (alias_idx_ready)
+        return;
+
+    for (i = 0; i < alias_rule_map_count; i++) {
+        rid = alias_rule_map[i].alias_rule_id;
+        if ((uint32_t)rid < RULE_ID_SENTINEL && rule_test_map[rid].alias_idx == 0)
+            rule_test_map[rid].alias_idx = (uint16_t)(i + 1);
+    }
+    alias_idx_ready = 1;
+}
+
 /**
  * @brief Get the index of an alias rule in alias_rule_map.
  *
- * Performs a linear scan over the compile-time `alias_rule_map` and returns
- * the zero-based index of the entry whose `alias_rule_id` matches the input.
- * If no entry matches, returns `INVALID_IDX`.
+ * Reads the `alias_idx` recorded by `alias_rule_map_build_index`. If no entry
+ * matches, returns `INVALID_IDX`.
  *
  * @param alias_rule_id Alias rule identifier to look up.
  * @return uint32_t Zero-based index in `alias_rule_map`, or `INVALID_IDX` if not found.
@@ -327,17 +353,11 @@ void rule_status_map_reset(void)
 uint32_t
 alias_rule_map_get_index(RULE_ID_e alias_rule_id)
 {
+    if ((uint32_t)alias_rule_id >= RULE_ID_SENTINEL)
+        return INVALID_IDX;
 
-    uint32_t i;
-
-    /* Iterate over all entries in the alias map */
-    for (i = 0; i <  alias_rule_map_count; i++) {
-        /* Check if the current entry's alias matches the requested ID */
-        if (alias_rule_map[i].alias_rule_id == alias_rule_id) {
-            return i;  /* found: return its index */
-        }
-    }
+    if (rule_test_map[alias_rule_id].alias_idx == 0)
+        return INVALID_IDX;
 
-    /* Not found: return sentinel indicating absence */
-    return INVALID_IDX;
+    return rule_test_map[alias_rule_id].alias_idx - 1;
 }
@@ -58,42 +58,266 @@ static uint32_t check_rule_support(RULE_ID_e rule_id)
     return TEST_SUPPORTED; /* supported on current PAL */
 }
 
+/* Level and software view of each rule of the selected arch table, indexed by
+ * RULE_ID_e and built once per arch. A level of 0 means the rule is not in the
+ * table. Software view is kept as (1 << SOFTWARE_VIEW_e), BSA only.
+ */
+static uint8_t  g_arch_rule_level[RULE_ID_SENTINEL];
+static uint8_t  g_arch_rule_sw_view[RULE_ID_SENTINEL];
+static uint32_t g_arch_rule_index_arch = ARCH_NONE;
+
 /**
- * @brief Determine if a rule should be skipped based on CLI options.
+ * @brief Read an entry of the rule lookup table of an architecture.
  *
- * Checks whether the provided rule ID is present in the explicit skip list
- * (-skip) or whether its module is present in the skip-modules list
- * (-skipmodule).
+ * @param arch     Architecture selection (ARCH_SEL_e).
+ * @param idx      Index of the entry in the table.
+ * @param rule_id  Rule ID of the entry.
+ * @param level    Level of the entry.
+ * @param sw_view  Software view bit of the entry, 0 if the arch has none.
+ * @return true if the entry exists, false at the end of the table.
+ */
+static bool arch_rule_entry(uint32_t arch, uint32_t idx, RULE_ID_e *rule_id,
+                            uint32_t *level, uint32_t *sw_view)
+{
+    *sw_view = 0;
+
+    switch (arch) {
+    case ARCH_BSA:
+        *rule_id = bsa_rule_list[idx].rule_id;
+        *level = (uint32_t)bsa_rule_list[idx].level;
+        *sw_view = (1u << (uint32_t)bsa_rule_list[idx].sw_view);
+        break;
+    case ARCH_SBSA:
+        *rule_id = sbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)sbsa_rule_list[idx].level;
+        break;
+    case ARCH_PCBSA:
+        *rule_id = pcbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)pcbsa_rule_list[idx].level;
+        break;
+    case ARCH_VBSA:
+        *rule_id = vbsa_rule_list[idx].rule_id;
+        *level = (uint32_t)vbsa_rule_list[idx].level;
+        break;
+    case ARCH_PFDI:
+        *rule_id = pfdi_rule_list[idx].rule_id;
+        *level = (uint32_t)pfdi_rule_list[idx].level;
+        break;
+    default:
+        return 0;
+    }
+
+    return (*rule_id != RULE_ID_SENTINEL);
+}
+
+/**
+ * @brief Return the FR level of an architecture, 0 if it has none.
+ */
+static uint32_t arch_level_fr(uint32_t arch)
+{
+    switch (arch) {
+    case ARCH_BSA:
+        return BSA_LEVEL_FR;
+    case ARCH_SBSA:
+        return SBSA_LEVEL_FR;
+    case ARCH_PCBSA:
+        return PCBSA_LEVEL_FR;
+    case ARCH_VBSA:
+        return VBSA_LEVEL_FR;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Build the rule to level/software view index of an architecture.
+ *
+ * The first entry of a rule in the arch table wins. The index is kept until a
+ * different architecture is requested.
+ *
+ * @param arch Architecture selection (ARCH_SEL_e).
+ */
+static void build_arch_rule_index(uint32_t arch)
+{
+    uint32_t i;
+    uint32_t level;
+    uint32_t sw_view;
+    RULE_ID_e rid;
+
+    if (arch == g_arch_rule_index_arch)
+        return;
+
+    val_memory_set(g_arch_rule_level, sizeof(g_arch_rule_level), 0);
+    val_memory_set(g_arch_rule_sw_view, sizeof(g_arch_rule_sw_view), 0);
+
+    for (i = 0; arch_rule_entry(arch, i, &rid, &level, &sw_view); i++) {
+        if ((uint32_t)rid >= RULE_ID_SENTINEL || g_arch_rule_level[rid] != 0)
+            continue;
+        g_arch_rule_level[rid] = (uint8_t)level;
+        g_arch_rule_sw_view[rid] = (uint8_t)sw_view;
+    }
+
+    g_arch_rule_index_arch = arch;
+}
+
+/**
+ * @brief Check a rule against the level and software view selections.
+ *
+ * Rules absent from the selected arch table are kept.
  *
  * @param rule_id Rule identifier to check.
- * @return true (1) if the rule should be skipped, false(0) otherwise.
+ * @return true (1) if the rule is selected, false(0) otherwise.
  */
-static bool is_rule_skipped(const acs_run_request_t *ctx, RULE_ID_e rule_id)
+static bool is_rule_level_selected(const acs_run_request_t *ctx, RULE_ID_e rule_id)
+{
+    uint32_t level = g_arch_rule_level[rule_id];
+    uint32_t level_fr;
+
+    if (level == 0)
+        return 1;
+
+    /* Software view filter if requested: keep if any selected */
+    if (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0 &&
+        (ctx->bsa_sw_view_mask & g_arch_rule_sw_view[rule_id]) == 0)
+        return 0;
+
+    if (ctx->level_filter_mode == LVL_FILTER_FR) {
+        /* Treat FR mode as MAX up to FR */
+        level_fr = arch_level_fr(ctx->arch_selection);
+        if (level_fr != 0 && level > level_fr)
+            return 0;
+    } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
+        if (level != ctx->level_value)
+            return 0;
+    } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
+        if (level > ctx->level_value)
+            return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Return the bitmask of a list of module IDs, one bit per MODULE_NAME_e.
+ */
+static uint32_t module_list_mask(const uint32_t *modules, uint32_t count)
 {
     uint32_t i;
-    MODULE_NAME_e module;
+    uint32_t mask = 0;
 
-    if (ctx == NULL)
+    if (modules == NULL)
         return 0;
 
-    /* Check explicit rule skip list (-skip) */
+    for (i = 0; i < count; i++) {
+        if (modules[i] < MODULE_ID_SENTINEL)
+            mask |= (1u << modules[i]);
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Build the set of rules removed by the CLI selections.
+ *
+ * Covers the explicit skip list (-skip) and the skip-modules list
+ * (-skipmodule). With select set, also covers rules outside the modules of
+ * -m and rules filtered out by level or software view.
+ *
+ * @param ctx     Run request holding the CLI selections.
+ * @param select  Apply the -m, level and software view selections too.
+ * @param drop    Set of rules to drop.
+ */
+static void build_drop_set(const acs_run_request_t *ctx, bool select, rule_set_t *drop)
+{
+    uint32_t i;
+    uint32_t drop_modules;
+    bool level_filter;
+    RULE_ID_e rid;
+
+    rule_set_clear(drop);
+
     if (ctx->skip_rule_count > 0 && ctx->skip_rule_list != NULL) {
-        for (i = 0; i < ctx->skip_rule_count; i++) {
-            if (ctx->skip_rule_list[i] == rule_id)
-                return 1;
-        }
+        for (i = 0; i < ctx->skip_rule_count; i++)
+            rule_set_add(drop, ctx->skip_rule_list[i]);
+    }
+
+    drop_modules = 0;
+    if (ctx->num_skip_modules > 0)
+        drop_modules = module_list_mask(ctx->skip_modules, ctx->num_skip_modules);
+
+    level_filter = 0;
+    if (select) {
+        /* If -m provided, keep only selected modules */
+        if (ctx->num_modules > 0 && ctx->execute_modules != NULL)
+            drop_modules |= ~module_list_mask(ctx->execute_modules, ctx->num_modules);
+
+        /* Level-based filtering and software view filtering (BSA) */
+        level_filter = (ctx->arch_selection != ARCH_NONE) &&
+                       (ctx->level_filter_mode != LVL_FILTER_NONE ||
+                        (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0));
+    }
+
+    if (drop_modules == 0 && !level_filter)
+        return;
+
+    for (i = 0; i < RULE_ID_SENTINEL; i++) {
+        rid = (RULE_ID_e)i;
+        if ((drop_modules & (1u << (uint32_t)rule_test_map[rid].module_id)) ||
+            (level_filter && !is_rule_level_selected(ctx, rid)))
+            rule_set_add(drop, rid);
     }
+}
+
+/**
+ * @brief Merge the rules of the selected architecture into the rule list.
+ *
+ * Rules of the arch table are appended in table order, skipping the ones
+ * already present in the list.
+ */
+static void merge_arch_rules(acs_run_request_t *ctx)
+{
+    uint32_t i;
+    uint32_t add_count = 0;
+    uint32_t new_count;
+    uint32_t level;
+    uint32_t sw_view;
+    RULE_ID_e rid;
+    RULE_ID_e *new_list;
+    rule_set_t present;
+
+    while (arch_rule_entry(ctx->arch_selection, add_count, &rid, &level, &sw_view))
+        add_count++;
+
+    if (add_count == 0)
+        return;
 
-    /* Check module skip list (-skipmodule) */
-    if (ctx->num_skip_modules > 0 && ctx->skip_modules != NULL) {
-        module = rule_test_map[rule_id].module_id;
-        for (i = 0; i < ctx->num_skip_modules; i++) {
-            if (ctx->skip_modules[i] == (uint32_t)module)
-                return 1;
+    /* Allocate a new buffer sized for worst-case unique merge */
+    new_list = (RULE_ID_e *)val_memory_alloc((ctx->rule_count + add_count) * sizeof(RULE_ID_e));
+    if (new_list == NULL)
+        return;
+
+    /* Copy existing */
+    rule_set_clear(&present);
+    for (i = 0; i < ctx->rule_count; i++) {
+        new_list[i] = ctx->rule_list[i];
+        rule_set_add(&present, ctx->rule_list[i]);
+    }
+    new_count = ctx->rule_count;
+
+    /* Append unique entries from table */
+    for (i = 0; i < add_count; i++) {
+        arch_rule_entry(ctx->arch_selection, i, &rid, &level, &sw_view);
+        if (!rule_set_contains(&present, rid)) {
+            rule_set_add(&present, rid);
+            new_list[new_count++] = rid;
         }
     }
 
-    return 0;
+    if (ctx->rule_list_owned && ctx->rule_list != NULL)
+        val_memory_free(ctx->rule_list);
+    ctx->rule_list = new_list;
+    ctx->rule_count = new_count;
+    ctx->rule_list_owned = true;
 }
 
 /**
@@ -105,9 +329,12 @@ static bool is_rule_skipped(const acs_run_request_t *ctx, RULE_ID_e rule_id)
  * - Rules whose module matches any in ctx->skip_modules are removed.
  * - If ctx->execute_modules is provided and non-empty, only rules whose module
  *   is in that list are kept.
+ * - With an architecture selected, rules of its table are merged in and rules
+ *   outside the level and software view selections are removed.
  *
- * No new memory is allocated. Elements beyond the returned count remain
- * unchanged but are considered out of range by callers.
+ * The selections are folded into one rule set up front, so each rule is
+ * checked with a single bit test. The list is reallocated only when an
+ * architecture is merged in.
  *
  * @return New count of rules after filtering.
  */
@@ -115,278 +342,250 @@ uint32_t filter_rule_list_by_cli(acs_run_request_t *ctx)
 {
     uint32_t out;
     uint32_t i;
-    uint32_t si;
-    uint32_t mi;
     RULE_ID_e rule;
-    bool skip;
-    MODULE_NAME_e module;
-    bool found;
-    /* Pointers to lookup tables for selected arch (if any) */
-    const bsa_rule_entry_t   *bsa_tbl   = NULL;
-    const sbsa_rule_entry_t  *sbsa_tbl  = NULL;
-    const pcbsa_rule_entry_t *pcbsa_tbl = NULL;
-    const vbsa_rule_entry_t  *vbsa_tbl  = NULL;
-    const pfdi_rule_entry_t  *pfdi_tbl  = NULL;
-    uint32_t tbl_count = 0;
+    rule_set_t drop;
 
     if (ctx == NULL)
         return 0;
 
     /* If architecture is selected (-a), merge its rules into the list, deduped */
     if (ctx->arch_selection != ARCH_NONE) {
-        uint32_t add_count = 0;
-
-        if (ctx->arch_selection == ARCH_BSA) {
-            /* count BSA entries */
-            while (bsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            bsa_tbl = bsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_SBSA) {
-            while (sbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            sbsa_tbl = sbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_PCBSA) {
-            while (pcbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            pcbsa_tbl = pcbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_VBSA) {
-            while (vbsa_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            vbsa_tbl = vbsa_rule_list;
-        } else if (ctx->arch_selection == ARCH_PFDI) {
-            while (pfdi_rule_list[add_count].rule_id != RULE_ID_SENTINEL)
-                add_count++;
-            pfdi_tbl = pfdi_rule_list;
-        }
-
-        if (add_count > 0) {
-            /* Allocate a new buffer sized for worst-case unique merge */
-            RULE_ID_e *old_list = ctx->rule_list;
-            uint32_t old_count = ctx->rule_count;
-            RULE_ID_e *new_list = (RULE_ID_e *)val_memory_alloc((old_count + add_count)
-                                   * sizeof(RULE_ID_e));
-            if (new_list != NULL) {
-                /* Copy existing */
-                for (i = 0; i < old_count; i++) new_list[i] = old_list[i];
-                uint32_t new_count = old_count;
-                /* Append unique entries from table */
-                if (bsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = bsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (sbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = sbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (pcbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = pcbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (vbsa_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = vbsa_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                } else if (pfdi_tbl) {
-                    for (i = 0; i < add_count; i++) {
-                        RULE_ID_e rid = pfdi_tbl[i].rule_id;
-                        if (!rule_in_list(rid, new_list, new_count))
-                            new_list[new_count++] = rid;
-                    }
-                }
-
-                if (ctx->rule_list_owned && old_list != NULL)
-                    val_memory_free(old_list);
-                ctx->rule_list = new_list;
-                ctx->rule_count = new_count;
-                ctx->rule_list_owned = true;
-            }
-        }
-
-        /* Also capture the selected table pointer and count for filtering by level */
-        if (ctx->arch_selection == ARCH_BSA) {
-            bsa_tbl = bsa_rule_list;
-            while (bsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_SBSA) {
-            sbsa_tbl = sbsa_rule_list;
-            while (sbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_PCBSA) {
-            pcbsa_tbl = pcbsa_rule_list;
-            while (pcbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_VBSA) {
-            vbsa_tbl = vbsa_rule_list;
-            while (vbsa_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        } else if (ctx->arch_selection == ARCH_PFDI) {
-            pfdi_tbl = pfdi_rule_list;
-            while (pfdi_tbl[tbl_count].rule_id != RULE_ID_SENTINEL) tbl_count++;
-        }
+        build_arch_rule_index(ctx->arch_selection);
+        merge_arch_rules(ctx);
     }
 
     /* if rule list is NULL no filtering required */
     if (ctx->rule_list == NULL || ctx->rule_count == 0)
         return 0;
 
+    build_drop_set(ctx, 1, &drop);
+
     out = 0;
     for (i = 0; i < ctx->rule_count; i++) {
         rule = ctx->rule_list[i];
-        skip = 0;
-
-        /* Skip explicit rule IDs provided via -skip */
-        if (!skip && ctx->skip_rule_count > 0 && ctx->skip_rule_list != NULL) {
-            for (si = 0; si < ctx->skip_rule_count; si++) {
-                if (ctx->skip_rule_list[si] == rule) {
-                    skip = 1;
-                    break;
-                }
-            }
-        }
+        if (!rule_set_contains(&drop, rule))
+            ctx->rule_list[out++] = rule;
+    }
+
+    ctx->rule_count = out;
+    return out;
+}
 
-        module = rule_test_map[rule].module_id;
+#ifndef TARGET_LINUX
+/* Test entries that may run on any PE alongside each other. Each one forces a
+ * single PE, only reads VAL information tables, ID registers or read-only
+ * GIC registers, keeps its result in the status slot of the PE it runs on,
+ * allocates no memory and installs no exception or interrupt handler. Entries
+ * which program shared hardware (PCIe, SMMU, GIC, timers, watchdogs) or depend
+ * on running on the primary PE must not be listed here. Of the PE module only
+ * pe002 and pe026 qualify, the other PE entries run on all PEs or, like pe010,
+ * program the GIC.
+ */
+static const TEST_ENTRY_ID_e pe_local_entry_list[] = {
+    PE002_ENTRY,
+    PE026_ENTRY,
+    G001_ENTRY,
+    G004_ENTRY,
+    G012_ENTRY,
+    G015_ENTRY,
+    G016_ENTRY,
+    T001_ENTRY,
+    T006_ENTRY,
+};
+
+/* Per-PE status of the rule dispatched by the parallel scheduler */
+static uint32_t *g_rule_sched_status;
+
+/* Per-PE system counter ticks spent in the dispatched rule */
+static uint64_t *g_rule_sched_ticks;
 
-        /* Skip rules belonging to modules listed in -skipmodule */
-        if (!skip && ctx->num_skip_modules > 0 && ctx->skip_modules != NULL) {
-            for (mi = 0; mi < ctx->num_skip_modules; mi++) {
-                if (ctx->skip_modules[mi] == (uint32_t)module) {
-                    skip = 1;
-                    break;
-                }
+/**
+ * @brief Check whether a rule can be dispatched to a secondary PE.
+ *
+ * Only supported base rules whose test entry is in pe_local_entry_list are
+ * eligible, alias rules and their base rules always run in sequence.
+ */
+static bool is_rule_pe_local(RULE_ID_e rule_id)
+{
+    uint32_t i;
+
+    if (rule_test_map[rule_id].flag != BASE_RULE ||
+        check_rule_support(rule_id) != TEST_SUPPORTED)
+        return 0;
+
+    for (i = 0; i < sizeof(pe_local_entry_list) / sizeof(pe_local_entry_list[0]); i++) {
+        if (rule_test_map[rule_id].test_entry_id == pe_local_entry_list[i])
+            return test_entry_func_table[pe_local_entry_list[i]] != NULL;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Secondary PE payload of the parallel scheduler, runs one rule.
+ *
+ * The rule id is passed as the test input of val_execute_on_pe(). On a
+ * secondary PE val_initialize_test() and val_check_for_error() only track the
+ * status of the PE, the heap test arena, the exception handler and the
+ * checkpoint print stay with the primary PE.
+ */
+static void rule_sched_payload(void)
+{
+    uint64_t data0, data1;
+    uint64_t start;
+    uint32_t index = val_pe_get_index_mpid(val_pe_get_mpid());
+    RULE_ID_e rule_id;
+
+    val_get_test_data(index, &data0, &data1);
+    rule_id = (RULE_ID_e)data1;
+
+    start = syscounter_read();
+    g_rule_sched_status[index] =
+        test_entry_func_table[rule_test_map[rule_id].test_entry_id](1);
+    g_rule_sched_ticks[index] = syscounter_read() - start;
+    val_data_cache_ops_by_va((addr_t)&g_rule_sched_ticks[index], CLEAN_AND_INVALIDATE);
+    val_data_cache_ops_by_va((addr_t)&g_rule_sched_status[index], CLEAN_AND_INVALIDATE);
+}
+
+/**
+ * @brief Run the PE-local rules of the list on idle secondary PEs.
+ *
+ * Rules are dealt in list order to the secondary PEs, one rule per PE, and the
+ * primary PE waits for each wave before starting the next. Status is recorded
+ * in rule_status_map and the rule is added to done, so run_tests() reports it
+ * in list order without running it again. A rule whose PE could not be started
+ * is left out of done and runs in sequence. A rule still pending after
+ * TIMEOUT_LARGE is reported as failed, it is not run again since its PE may
+ * still be executing it.
+ *
+ * Rules are only dispatched to the PE worker pool, where starting a rule is a
+ * doorbell. Without it each rule would cost a PSCI CPU_ON and a boot of the
+ * PE, more than running the rule on the primary PE. The time the rules spent
+ * on the secondary PEs and the time the scheduler took are printed, so that
+ * the gain can be checked on the platform.
+ *
+ * @param rule_list Sorted rule list.
+ * @param list_size Number of rules in rule_list.
+ * @param num_pe    Number of PEs in the system.
+ * @param done      Set of rules which completed on a secondary PE.
+ */
+static void run_pe_local_rules(const RULE_ID_e *rule_list, uint32_t list_size,
+                               uint32_t num_pe, rule_set_t *done)
+{
+    uint32_t my_index = val_pe_get_index_mpid(val_pe_get_mpid());
+    uint32_t *sched_rule;
+    uint32_t i, pe;
+    uint32_t pending;
+    uint32_t timeout;
+    uint32_t status;
+    uint32_t num_run = 0;
+    uint64_t start, busy = 0;
+    uint64_t freq;
+
+    rule_set_clear(done);
+
+    if (num_pe < 2 || !val_pe_pool_enabled())
+        return;
+
+    g_rule_sched_status = val_memory_calloc(2 * num_pe, sizeof(uint32_t));
+    g_rule_sched_ticks = val_memory_calloc(num_pe, sizeof(uint64_t));
+    if (g_rule_sched_status == NULL || g_rule_sched_ticks == NULL) {
+        if (g_rule_sched_status != NULL)
+            val_memory_free(g_rule_sched_status);
+        if (g_rule_sched_ticks != NULL)
+            val_memory_free(g_rule_sched_ticks);
+        g_rule_sched_status = NULL;
+        g_rule_sched_ticks = NULL;
+        return;
+    }
+    sched_rule = g_rule_sched_status + num_pe;
+
+    val_data_cache_ops_by_va((addr_t)&g_rule_sched_status, CLEAN_AND_INVALIDATE);
+    val_data_cache_ops_by_va((addr_t)&g_rule_sched_ticks, CLEAN_AND_INVALIDATE);
+
+    /* Dispatched rules do not install a handler of their own */
+    val_pe_initialize_default_exception_handler(val_pe_default_esr);
+
+    /* Dispatched rules print from their own PE, keep each message whole */
+    val_log_set_shared(1);
+
+    start = syscounter_read();
+
+    i = 0;
+    while (i < list_size) {
+        pending = 0;
+        for (pe = 0; pe < num_pe && i < list_size; pe++) {
+            if (pe == my_index)
+                continue;
+
+            while (i < list_size && !is_rule_pe_local(rule_list[i]))
+                i++;
+            if (i == list_size)
+                break;
+
+            g_rule_sched_status[pe] = RESULT_PENDING(0);
+            val_data_cache_ops_by_va((addr_t)&g_rule_sched_status[pe], CLEAN_AND_INVALIDATE);
+
+            if (val_execute_on_pe(pe, rule_sched_payload, rule_list[i]) == ACS_STATUS_PASS) {
+                sched_rule[pe] = rule_list[i];
+                pending++;
+            } else {
+                /* PE not started, rule runs in sequence */
+                sched_rule[pe] = RULE_ID_SENTINEL;
             }
+            i++;
         }
 
-        /* If -m provided, keep only selected modules */
-        if (!skip && ctx->num_modules > 0 && ctx->execute_modules != NULL) {
-            found = 0;
-            for (mi = 0; mi < ctx->num_modules; mi++) {
-                if (ctx->execute_modules[mi] == (uint32_t)module) {
-                    found = 1;
-                    break; }
+        timeout = TIMEOUT_LARGE;
+        while (pending && --timeout) {
+            for (pe = 0; pe < num_pe; pe++) {
+                if (pe == my_index || sched_rule[pe] == RULE_ID_SENTINEL)
+                    continue;
+
+                val_data_cache_ops_by_va((addr_t)&g_rule_sched_status[pe], INVALIDATE);
+                status = g_rule_sched_status[pe];
+                if (IS_RESULT_PENDING(status))
+                    continue;
+
+                val_data_cache_ops_by_va((addr_t)&g_rule_sched_ticks[pe], INVALIDATE);
+                busy += g_rule_sched_ticks[pe];
+                num_run++;
+
+                rule_status_map[sched_rule[pe]] = status;
+                rule_set_add(done, sched_rule[pe]);
+                sched_rule[pe] = RULE_ID_SENTINEL;
+                pending--;
             }
-            if (!found)
-                skip = 1;
         }
 
-        /* Level-based filtering and software view filtering (BSA) */
-        if (!skip && ctx->arch_selection != ARCH_NONE) {
-            if (ctx->level_filter_mode != LVL_FILTER_NONE ||
-                (ctx->arch_selection == ARCH_BSA && ctx->bsa_sw_view_mask != 0)) {
-                /* Find rule in the selected arch table */
-                bool found_entry = 0;
-                if (bsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (bsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            /* Software view filter if requested: keep if any selected */
-                            if (ctx->bsa_sw_view_mask != 0) {
-                                uint32_t bit = (1u << (uint32_t)bsa_tbl[ti].sw_view);
-                                if ((ctx->bsa_sw_view_mask & bit) == 0) {
-                                    skip = 1;
-                                    break;
-                                }
-                            }
-                            /* Level filtering */
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)bsa_tbl[ti].level > (uint32_t)BSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)bsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)bsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (sbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (sbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)sbsa_tbl[ti].level > (uint32_t)SBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)sbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)sbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (pcbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (pcbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)pcbsa_tbl[ti].level > (uint32_t)PCBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)pcbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)pcbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (vbsa_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (vbsa_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_FR) {
-                                /* Treat FR mode as MAX up to FR */
-                                if ((uint32_t)vbsa_tbl[ti].level > (uint32_t)VBSA_LEVEL_FR)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)vbsa_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)vbsa_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                } else if (pfdi_tbl) {
-                    for (uint32_t ti = 0; ti < tbl_count; ti++) {
-                        if (pfdi_tbl[ti].rule_id == rule) {
-                            found_entry = 1;
-                            if (ctx->level_filter_mode == LVL_FILTER_ONLY) {
-                                if ((uint32_t)pfdi_tbl[ti].level != ctx->level_value)
-                                    skip = 1;
-                            } else if (ctx->level_filter_mode == LVL_FILTER_MAX) {
-                                if ((uint32_t)pfdi_tbl[ti].level > ctx->level_value)
-                                    skip = 1;
-                            }
-                            break;
-                        }
-                    }
-                }
+        for (pe = 0; pe < num_pe && pending; pe++) {
+            if (pe == my_index || sched_rule[pe] == RULE_ID_SENTINEL)
+                continue;
 
-                /* If not found in table, conservatively skip or keep? Keep by default */
-                (void)found_entry; /* silence unused if not used */
-            }
+            val_print(ERROR, "\n       Rule timed out on PE index %d", pe);
+            rule_status_map[sched_rule[pe]] = RESULT_FAIL(0xF);
+            rule_set_add(done, sched_rule[pe]);
+            sched_rule[pe] = RULE_ID_SENTINEL;
+            pending--;
         }
+    }
 
-        if (!skip)
-            ctx->rule_list[out++] = rule;
+    val_log_set_shared(0);
+
+    freq = val_get_counter_frequency();
+    if (num_run && freq) {
+        val_print(INFO, "\n Parallel rules run      : %d", num_run);
+        val_print(INFO, "\n Parallel rules busy (us): %d", busy * 1000000 / freq);
+        val_print(INFO, "\n Parallel rules wall (us): %d",
+                  (syscounter_read() - start) * 1000000 / freq);
     }
 
-    ctx->rule_count = out;
-    return out;
+    val_memory_free(g_rule_sched_ticks);
+    g_rule_sched_ticks = NULL;
+    val_memory_free(g_rule_sched_status);
+    g_rule_sched_status = NULL;
 }
+#endif /* TARGET_LINUX */
 
 /**
  * @brief Execute the provided list of rules and report status per rule.
@@ -396,6 +595,9 @@ uint32_t filter_rule_list_by_cli(acs_run_request_t *ctx)
  * alias rules executes their base rules while aggregating status. Records and
  * prints status per rule.
  *
+ * When the parallel_rules policy is set, PE-local rules are run first on idle
+ * secondary PEs and their recorded status is reported at their place in the
+ * list.
  */
 void
 run_tests(const acs_run_request_t *ctx)
@@ -414,10 +616,15 @@ run_tests(const acs_run_request_t *ctx)
     RULE_ID_e *base_rule_list;
     RULE_ID_e *rule_list;
     uint32_t list_size;
+    rule_set_t skip_set;
+    rule_set_t sched_done;
 
     if (ctx == NULL || ctx->rule_list == NULL || ctx->rule_count == 0)
         return;
 
+    /* -skip and -skipmodule selections, applied to the base rules of aliases */
+    build_drop_set(ctx, 0, &skip_set);
+
     rule_list = ctx->rule_list;
     list_size = ctx->rule_count;
 
@@ -426,12 +633,21 @@ run_tests(const acs_run_request_t *ctx)
     /* Initialize per-rule status map to TEST_STATUS_UNKNOWN for this run */
     rule_status_map_reset();
 
+    /* Alias lookups below read this index, build it before any PE is dispatched */
+    alias_rule_map_build_index();
+
     /* Get number of PEs in the system */
     num_pe = val_pe_get_num();
 
     /* quick sort the rule list so that it is module wise as in RULE_ID_e typedef definition */
     quick_sort_rule_list(rule_list, list_size);
 
+    rule_set_clear(&sched_done);
+#ifndef TARGET_LINUX
+    if (acs_policy_get_parallel_rules())
+        run_pe_local_rules(rule_list, list_size, num_pe, &sched_done);
+#endif
+
     for (i = 0 ; i < list_size; i++) {
         /* Invalid  rule_test_map entry check */
         // if (rule_test_map[rule_list[i]].flag == INVALID_ENTRY) {
@@ -460,6 +676,13 @@ run_tests(const acs_run_request_t *ctx)
             goto report_status;
         }
 
+        /* Rule already completed on a secondary PE, report the recorded status */
+        if (rule_set_contains(&sched_done, rule_list[i])) {
+            rule_test_status = rule_status_map[rule_list[i]];
+            val_print_checkpoint(rule_test_status);
+            goto report_status;
+        }
+
         g_base_rule = rule_list[i];
 
         /* Check if rule id is alias, if yes do the table walk to find base rules */
@@ -518,7 +741,7 @@ run_tests(const acs_run_request_t *ctx)
 #endif
                 /* -skip and -skipmodule only apply to initial rule list; ensure
                    base rules of an alias honor these selections here. */
-                if (is_rule_skipped(ctx, base_rule_list[j])) {
+                if (rule_set_contains(&skip_set, base_rule_list[j])) {
                     /* Skip executing this base rule as per CLI selection */
                     continue;
                 }
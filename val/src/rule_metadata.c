@@ -62,14 +62,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = BASE,
-            .rule_desc        = "BSA Level 1 requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [P_L1_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = BASE,
-            .rule_desc        = "BSA Level 1 requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
@@ -77,7 +75,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_01] = {
             .test_entry_id    = PE001_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Arch symmetry across PE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  1,
@@ -85,7 +82,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_02] = {
             .test_entry_id    = PE002_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for number of PE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  2,
@@ -93,7 +89,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_03] = {
             .test_entry_id    = PE003_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for AdvSIMD and FP support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  3,
@@ -101,7 +96,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_04] = {
             .test_entry_id    = PE004_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PE 4KB Granule Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  4,
@@ -109,7 +103,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_06] = {
             .test_entry_id    = PE006_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Cryptographic extensions",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  6,
@@ -117,7 +110,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_07] = {
             .test_entry_id    = PE007_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Little Endian support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  7,
@@ -125,7 +117,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_08] = {
             .test_entry_id    = PE008_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check EL1 and EL0 implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  8,
@@ -133,7 +124,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_09] = {
             .test_entry_id    = PE009_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for PMU and PMU counters",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  9,
@@ -141,7 +131,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_10] = {
             .test_entry_id    = PE010_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PMU Overflow signal",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  10,
@@ -149,7 +138,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_11] = {
             .test_entry_id    = PE011_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check num of Breakpoints and type",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  11,
@@ -157,7 +145,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_12] = {
             .test_entry_id    = PE012_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Synchronous Watchpoints",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  12,
@@ -165,7 +152,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_13] = {
             .test_entry_id    = PE013_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check CRC32 instruction support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  13,
@@ -173,7 +159,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_14] = {
             .test_entry_id    = PE016_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check SVE2 for v9 PE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  16,
@@ -181,7 +166,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_18] = {
             .test_entry_id    = PE017_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check EL2 implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 17,
@@ -189,7 +173,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_19] = {
             .test_entry_id    = PE018_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Stage 2 4KB Granule Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  18,
@@ -197,7 +180,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_20] = {
             .test_entry_id    = PE019_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Stage2 and Stage1 Granule match",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 19,
@@ -205,7 +187,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_21] = {
             .test_entry_id    = PE020_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for PMU counters",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  20,
@@ -213,7 +194,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_22] = {
             .test_entry_id    = PE021_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check VMID breakpoint number",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  21,
@@ -221,7 +201,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_23] = {
             .test_entry_id    = PE022_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for EL3 AArch64 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  22,
@@ -229,7 +208,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_24] = {
             .test_entry_id    = PE063_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for Secure state implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  63,
@@ -237,7 +215,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_17] = {
             .test_entry_id    = PE037_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check SPE if implemented",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  37,
@@ -245,7 +222,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PE_25] = {
             .test_entry_id    = PE015_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for FEAT_LSE support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  15,
@@ -253,7 +229,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [XRPZG] = {
             .test_entry_id    = PE066_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check num of Breakpoints and type",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  66,
@@ -261,7 +236,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SEC_01] = {
             .test_entry_id    = PE043_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Speculation Restriction",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  43,
@@ -269,7 +243,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SEC_02] = {
             .test_entry_id    = PE044_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Speculative Str Bypass Safe",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  44,
@@ -277,7 +250,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SEC_03] = {
             .test_entry_id    = PE045_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PEs Impl CSDB,SSBB,PSSBB",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 45,
@@ -285,7 +257,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SEC_04] = {
             .test_entry_id    = PE046_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PEs Implement SB Barrier",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  46,
@@ -293,7 +264,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SEC_05] = {
             .test_entry_id    = PE047_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PE Impl CFP,DVP,CPP RCTX",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  47,
@@ -301,7 +271,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3PE_01] = {
             .test_entry_id    = PE023_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PE Granule Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  23,
@@ -309,7 +278,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3PE_02] = {
             .test_entry_id    = PE024_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for 16-bit ASID support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  24,
@@ -317,7 +285,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3PE_03] = {
             .test_entry_id    = PE025_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check AARCH64 implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  25,
@@ -325,7 +292,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3PE_04] = {
             .test_entry_id    = PE026_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check FEAT_LPA Requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 26,
@@ -333,7 +299,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4PE_01] = {
             .test_entry_id    = PE027_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for RAS extension",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 27,
@@ -341,7 +306,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4PE_02] = {
             .test_entry_id    = PE028_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check DC CVAP support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 28,
@@ -349,7 +313,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4PE_03] = {
             .test_entry_id    = PE029_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for 16-Bit VMID",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 29,
@@ -357,7 +320,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4PE_04] = {
             .test_entry_id    = PE030_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for Virtual host extensions",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 30,
@@ -365,7 +327,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_01] = {
             .test_entry_id    = PE031_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Support Page table map size change",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  31,
@@ -373,7 +334,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_02] = {
             .test_entry_id    = PE032_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for addr and generic auth",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  32,
@@ -381,7 +341,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_04] = {
             .test_entry_id    = PE033_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Activity monitors extension",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  33,
@@ -389,7 +348,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_05] = {
             .test_entry_id    = PE034_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for SHA3 and SHA512 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  34,
@@ -397,7 +355,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_06] = {
             .test_entry_id    = PE035_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Stage 2 control of mem and cache",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  35,
@@ -405,7 +362,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PE_07] = {
             .test_entry_id    = PE036_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for nested virtualization",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  36,
@@ -413,14 +369,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PE security features",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [S_L6PE_02] = {
             .test_entry_id    = PE038_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Branch Target Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  38,
@@ -428,7 +382,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_03] = {
             .test_entry_id    = PE039_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Protect Against Timing Fault",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  39,
@@ -436,7 +389,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_04] = {
             .test_entry_id    = PE040_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PMU Version v3.5 or higher",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  40,
@@ -444,7 +396,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_05] = {
             .test_entry_id    = PE041_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check AccessFlag DirtyState Update",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  41,
@@ -452,7 +403,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_06] = {
             .test_entry_id    = PE042_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Enhanced Virtualization Trap",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  42,
@@ -460,7 +410,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_01] = {
             .test_entry_id    = PE048_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check Fine Grain Trap Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  48,
@@ -468,7 +417,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PE_08] = {
             .test_entry_id    = PE037_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check SPE if implemented",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  37,
@@ -476,7 +424,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_02] = {
             .test_entry_id    = PE049_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for ECV support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  49,
@@ -484,7 +431,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_04] = {
             .test_entry_id    = PE051_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Checks ASIMD Int8 matrix multiplc",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  51,
@@ -492,7 +438,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_05] = {
             .test_entry_id    = PE052_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for BFLOAT16 extension",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 52,
@@ -500,7 +445,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_06] = {
             .test_entry_id    = PE053_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PAuth2, FPAC & FPACCOMBINE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 53,
@@ -508,7 +452,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PE_07] = {
             .test_entry_id    = PE054_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for SVE Int8 matrix multiple",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 54,
@@ -516,7 +459,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_01] = {
             .test_entry_id    = PE058_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check XS attribute functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 58,
@@ -524,7 +466,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_02] = {
             .test_entry_id    = PE059_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check WFET and WFIT functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 59,
@@ -532,7 +473,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_03] = {
             .test_entry_id    = PE060_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check atomic 64 byte store support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 60,
@@ -540,7 +480,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_04] = {
             .test_entry_id    = PE057_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for enhanced PAN feature",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 57,
@@ -548,7 +487,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_05] = {
             .test_entry_id    = PE064_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PMU Version v3.7 or higher",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  64,
@@ -556,7 +494,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_06] = {
             .test_entry_id    = PE061_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for FEAT_BRBE support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 61,
@@ -564,7 +501,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8PE_07] = {
             .test_entry_id    = PE062_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for unsupported PBHA bits",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 62,
@@ -572,7 +508,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [WNPXD] = {
             .test_entry_id    = PE065_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for FEAT_PFAR support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 65,
@@ -581,7 +516,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_GIC_01] = {
             .test_entry_id    = G001_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GIC version",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 1,
@@ -589,7 +523,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_GIC_02] = {
             .test_entry_id    = G002_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICv2 Valid Configuration",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 2,
@@ -597,7 +530,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_GIC_03] = {
             .test_entry_id    = G003_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "If PCIe, GICv3 then ITS, LPI",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 3,
@@ -605,7 +537,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_GIC_04] = {
             .test_entry_id    = G004_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICv3 Security States",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 4,
@@ -613,7 +544,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_GIC_05] = {
             .test_entry_id    = G005_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Non-secure SGIs are implemented",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 5,
@@ -621,7 +551,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_01] = {
             .test_entry_id    = ITS001_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check number of ITS blocks in a group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_ITS_TEST_NUM_BASE + 1,
@@ -629,7 +558,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_02] = {
             .test_entry_id    = ITS002_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check ITS block association with group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_ITS_TEST_NUM_BASE + 2,
@@ -637,7 +565,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_DEV_2] = {
             .test_entry_id    = ITS003_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check uniqueness of StreamID",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_ITS_TEST_NUM_BASE + 3,
@@ -645,7 +572,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_DEV_7] = {
             .test_entry_id    = ITS004_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check Device's SID/RID/DID behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_ITS_TEST_NUM_BASE + 4,
@@ -653,7 +579,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_DEV_8] = {
             .test_entry_id    = ITS005_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check Device IDs not behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_ITS_TEST_NUM_BASE + 5,
@@ -661,7 +586,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3GI_01] = {
             .test_entry_id    = G012_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GIC version",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 12,
@@ -669,7 +593,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3GI_02] = {
             .test_entry_id    = P046_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check all MSI(X) vectors are LPIs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 46,
@@ -677,14 +600,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PPI_00] = {
             .test_entry_id    = B_PPI_00_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "PPI Assignments check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [S_L3PP_01] = {
             .test_entry_id    = G014_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check All PPI Interrupt IDs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 14,
@@ -692,7 +613,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5GI_01] = {
             .test_entry_id    = G016_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check Non standard GICv3 implmentation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 16,
@@ -700,7 +620,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5PP_01] = {
             .test_entry_id    = G013_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check Reserved PPI Assignments",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 13,
@@ -708,7 +627,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8GI_01] = {
             .test_entry_id    = G015_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICv4.1 or higher compliant",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 15,
@@ -716,7 +634,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [Appendix_I_5] = {
             .test_entry_id    = V2M004_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICv2m SPI allocated to MSI Ctrl",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_V2M_TEST_NUM_BASE + 4,
@@ -724,14 +641,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [Appendix_I_6] = {
             .test_entry_id    = APPENDIX_I_6_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [Appendix_I_9] = {
             .test_entry_id    = V2M002_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICv2m MSI Frame Register",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_V2M_TEST_NUM_BASE + 2,
@@ -740,7 +655,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_01] = {
             .test_entry_id    = D001_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "USB CTRL Interface EHCI check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 1,
@@ -748,7 +662,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_02] = {
             .test_entry_id    = D008_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "USB CTRL Interface XHCI check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 8,
@@ -756,7 +669,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_03] = {
             .test_entry_id    = D002_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check SATA CTRL Interface",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 2,
@@ -764,7 +676,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_05] = {
             .test_entry_id    = D003_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check UART type Arm Generic or 16550",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 3,
@@ -772,14 +683,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3PR_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check UART Arm Generic or 16550 presence",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [B_PER_06] = {
             .test_entry_id    = D006_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check ARM Generic UART Interrupt",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 6,
@@ -787,14 +696,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_08] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check PCI Express root complex",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [B_PER_09] = {
             .test_entry_id    = D004_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check Memory Attributes of DMA",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 4,
@@ -802,7 +709,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PER_10] = {
             .test_entry_id    = D007_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check DMA for I/O coherency",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PER_TEST_NUM_BASE + 7,
@@ -811,7 +717,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_01] = {
             .test_entry_id    = M002_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Mem Access Response in finite time",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 2,
@@ -819,7 +724,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_02] = {
             .test_entry_id    = M001_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Memory Access to Un-Populated addr",
             .platform_bitmask = PLATFORM_BAREMETAL,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 1,
@@ -827,7 +731,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_03] = {
             .test_entry_id    = M004_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Check Addressability",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 4,
@@ -835,7 +738,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_04] = {
             .test_entry_id    = M006_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Check dev DMA behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 6,
@@ -843,7 +745,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_06] = {
             .test_entry_id    = M007_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Check NS non-64b DMA devices are behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 7,
@@ -851,7 +752,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_MEM_05] = {
             .test_entry_id    = M003_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "PE must access all NS addr space",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 3,
@@ -859,7 +759,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3MM_01] = {
             .test_entry_id    = M005_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "NS-EL2 Stage-2 64KB Mapping Check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 5,
@@ -867,7 +766,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3MM_02] = {
             .test_entry_id    = M008_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Check peripherals addr 64Kb apart",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 8,
@@ -876,7 +774,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_PE_01] = {
             .test_entry_id    = PE040_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check Performance Monitors Extension",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  40,
@@ -884,7 +781,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_PE_02] = {
             .test_entry_id    = PMU001_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check PMU Overflow signal",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE  +  1,
@@ -892,7 +788,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_PE_03] = {
             .test_entry_id    = PMU002_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check number of PMU counters",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE  +  2,
@@ -900,7 +795,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_SYS_1] = {
             .test_entry_id    = PMU004_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Test Simultaneous 4 traffic measures",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 4,
@@ -908,7 +802,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_SYS_2] = {
             .test_entry_id    = PMU005_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Test Simultaneous 6 traffic measures",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 5,
@@ -916,7 +809,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_SYS_5] = {
             .test_entry_id    = PMU008_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check System PMU for NUMA systems",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 8
@@ -924,7 +816,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_SYS_6] = {
             .test_entry_id    = PMU009_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check multiple type traffic measurement",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 9,
@@ -932,7 +823,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_BM_1] = {
             .test_entry_id    = PMU007_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for memory bandwidth monitors",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 7,
@@ -940,7 +830,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_MEM_1] = {
             .test_entry_id    = PMU010_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for memory latency monitors",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 10,
@@ -948,7 +837,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_BM_2] = {
             .test_entry_id    = PMU011_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for PCIe bandwidth monitors",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 11,
@@ -956,7 +844,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_EV_11] = {
             .test_entry_id    = PMU003_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for multi-threaded PMU ext",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 3,
@@ -964,7 +851,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PMU_SPE] = {
             .test_entry_id    = PMU006_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for PMU SPE Requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PMU_TEST_NUM_BASE + 6,
@@ -972,14 +858,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7PMU] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PMU,
-            .rule_desc        = "Check for PMU Features",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [S_L8SHD_1] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check for ETE Features",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
@@ -987,7 +871,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_01] = {
             .test_entry_id    = RAS001_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check Error Counter",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 1,
@@ -995,7 +878,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_02] = {
             .test_entry_id    = RAS002_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check CFI, DUI, UI Controls",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 2,
@@ -1003,7 +885,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_03] = {
             .test_entry_id    = RAS003_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check FHI in Error Record Group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 3,
@@ -1011,7 +892,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_04] = {
             .test_entry_id    = RAS004_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check ERI in Error Record Group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 4,
@@ -1019,7 +899,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_06] = {
             .test_entry_id    = RAS005_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check ERI/FHI Connected to GIC",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 5,
@@ -1027,7 +906,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_07] = {
             .test_entry_id    = RAS006_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "RAS ERR<n>ADDR.AI bit status check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 6,
@@ -1035,7 +913,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_08] = {
             .test_entry_id    = RAS007_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check Error Group Status",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 7,
@@ -1043,7 +920,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RAS_11] = {
             .test_entry_id    = RAS008_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Software Fault Error Check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 8,
@@ -1051,7 +927,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7RAS_1] = {
             .test_entry_id    = RAS009_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Data abort on Containable err",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 9,
@@ -1059,7 +934,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_RAS_01] = {
             .test_entry_id    = RAS014_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check RAS SR Interface ERI/FHI are PPI",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 14,
@@ -1067,14 +941,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [SYS_RAS] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check Server RAS requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [SYS_RAS_1] = {
             .test_entry_id    = RAS010_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check for patrol scrubbing support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 10,
@@ -1082,14 +954,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [SYS_RAS_2] = {
             .test_entry_id    = RAS011_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check Poison Storage & Forwarding",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [SYS_RAS_3] = {
             .test_entry_id    = RAS015_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check Error when Poison unsupported",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 15,
@@ -1097,7 +967,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [SYS_RAS_4] = {
             .test_entry_id    = RAS013_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check RAS memory mapped view supp",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 13,
@@ -1105,14 +974,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [LVQBC] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check RASSA_RV, RASSA_DFI, CED supp",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [ZVDJG] = {
             .test_entry_id    = RAS016_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check FEAT_RASSA_RV implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 16,
@@ -1120,7 +987,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RKLPK] = {
             .test_entry_id    = RAS017_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Check FEAT_RASSA_DFI and CED support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 17,
@@ -1128,7 +994,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [KBRZG] = {
             .test_entry_id    = RAS018_ENTRY,
             .module_id        = RAS,
-            .rule_desc        = "Data abort on containable Device err",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_RAS_TEST_NUM_BASE + 18,
@@ -1137,7 +1002,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_01] = {
             .test_entry_id    = I001_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "All SMMUs have same Arch Revision",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 1,
@@ -1145,7 +1009,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_02] = {
             .test_entry_id    = I002_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Granule Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 2,
@@ -1153,7 +1016,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_03] = {
             .test_entry_id    = I016_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Large VA Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 16,
@@ -1161,7 +1023,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_04] = {
             .test_entry_id    = I017_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check TLB Range Invalidation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 17,
@@ -1169,7 +1030,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_05] = {
             .test_entry_id    = I030_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check DVM capabilities",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 30,
@@ -1177,7 +1037,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_06] = {
             .test_entry_id    = I003_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Large Physical Addr Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 3,
@@ -1185,7 +1044,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_08] = {
             .test_entry_id    = I004_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU S-EL2 & stage1 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 4,
@@ -1193,7 +1051,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_09] = {
             .test_entry_id    = I010_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check S-EL2 & SMMU Stage1 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 10,
@@ -1201,7 +1058,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_11] = {
             .test_entry_id    = I012_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU for MPAM support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 12,
@@ -1209,7 +1065,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_13] = {
             .test_entry_id    = I018_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU 16 Bit ASID Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 18,
@@ -1217,7 +1072,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_14] = {
             .test_entry_id    = I019_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Endianess Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 19,
@@ -1225,7 +1079,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_16] = {
             .test_entry_id    = I005_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMUs stage2 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 5,
@@ -1233,7 +1086,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_18] = {
             .test_entry_id    = I029_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU S-EL2 & stage2 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 29,
@@ -1241,7 +1093,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_19] = {
             .test_entry_id    = I006_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "SMMUv2 unique intr per ctxt bank",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 6,
@@ -1249,7 +1100,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_20] = {
             .test_entry_id    = I011_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check S-EL2 & SMMU Stage2 Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 11,
@@ -1257,14 +1107,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_SMMU_21] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "SMMUv3 Integration compliance",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [B_SMMU_23] = {
             .test_entry_id    = I015_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU 16 Bit VMID Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 15,
@@ -1272,7 +1120,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [SMMU_01] = {
             .test_entry_id    = I007_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "SMMUv3 Integration compliance",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 7,
@@ -1280,7 +1127,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4SM_01] = {
             .test_entry_id    = I008_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check Stage 1 SMMUv3 functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 8,
@@ -1288,7 +1134,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4SM_02] = {
             .test_entry_id    = I025_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check Stage 2 SMMUv3 functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 25,
@@ -1296,7 +1141,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4SM_03] = {
             .test_entry_id    = I020_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Coherent Access Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 20,
@@ -1304,7 +1148,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5SM_01] = {
             .test_entry_id    = I009_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMUv3.2 or higher",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 9,
@@ -1312,7 +1155,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5SM_02] = {
             .test_entry_id    = I026_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU L1 and L2 table resizing",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 26,
@@ -1320,7 +1162,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5SM_03] = {
             .test_entry_id    = I012_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU for MPAM support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 12,
@@ -1328,14 +1169,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L5SM_04] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "S-EL2 & SMMU Stage1 and Stage2 support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [S_L6SM_02] = {
             .test_entry_id    = I013_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU HTTU Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 13,
@@ -1343,7 +1182,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6SM_03] = {
             .test_entry_id    = I014_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU MSI Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 14,
@@ -1351,14 +1189,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6SM_04] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU large VA/TLB/DVM ASID VMID",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [S_L7SM_01] = {
             .test_entry_id    = I022_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check if all DMA reqs behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 22,
@@ -1366,7 +1202,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7SM_02] = {
             .test_entry_id    = I023_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check for SMMU/CATU in ETR Path",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 23,
@@ -1374,7 +1209,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7SM_03] = {
             .test_entry_id    = I021_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU PMU Extension presence",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 21,
@@ -1382,7 +1216,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7SM_04] = {
             .test_entry_id    = I027_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU PMCG has >= 4 counters",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 27,
@@ -1390,7 +1223,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8SM_01] = {
             .test_entry_id    = I028_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMUv3.3 or higher",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 28,
@@ -1399,7 +1231,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_01] = {
             .test_entry_id    = T001_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check for Generic System Counter",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 1,
@@ -1407,7 +1238,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_02] = {
             .test_entry_id    = T007_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check System Counter Frequency",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 7,
@@ -1415,7 +1245,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_06] = {
             .test_entry_id    = T002_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "SYS Timer if PE Timer not ON",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 2,
@@ -1423,7 +1252,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_07] = {
             .test_entry_id    = T003_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Memory mapped timer check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 3,
@@ -1431,7 +1259,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_08] = {
             .test_entry_id    = T004_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Generate Mem Mapped SYS Timer Intr",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 4,
@@ -1439,7 +1266,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_TIME_09] = {
             .test_entry_id    = T005_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Restore PE timer on PE wake up",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 5,
@@ -1447,7 +1273,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8TI_01] = {
             .test_entry_id    = T006_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check Minimum Counter Frequency 50MHz",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 6,
@@ -1456,14 +1281,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_WD_00] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Generic watchdog check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [B_WD_01] = {
             .test_entry_id    = W001_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Non Secure Watchdog Access ",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_WD_TEST_NUM_BASE + 1,
@@ -1471,7 +1294,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_WD_02] = {
             .test_entry_id    = W001_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Non Secure Watchdog Access ",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_WD_TEST_NUM_BASE + 1,
@@ -1479,7 +1301,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_WD_03] = {
             .test_entry_id    = W002_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Check Watchdog WS0 interrupt ",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_WD_TEST_NUM_BASE + 2,
@@ -1487,14 +1308,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L3WD_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Non-secure Generic watchdog check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [S_L6WD_01] = {
             .test_entry_id    = W003_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Check NS Watchdog Revision",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_WD_TEST_NUM_BASE + 3,
@@ -1504,7 +1323,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7ENT_1] = {
             .test_entry_id    = N001_ENTRY,
             .module_id        = NIST,
-            .rule_desc        = "NIST Statistical Test Suite",
             .platform_bitmask = 0,
             .flag             = BASE_RULE,
         },
@@ -1512,14 +1330,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_WAK_03] = {
             .test_entry_id    = B_WAK_03_07_ENTRY,
             .module_id        = POWER_WAKEUP,
-            .rule_desc        = "Check power wakeup interrupts",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [B_WAK_07] = {
             .test_entry_id    = B_WAK_03_07_ENTRY,
             .module_id        = POWER_WAKEUP,
-            .rule_desc        = "Check power wakeup interrupts",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
@@ -1527,42 +1343,36 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_REP_1] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RCiEP Devices",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [JKZMT] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RCiEP and RCEC PCIe requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [B_IEP_1] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check i-EP Devices",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [HVZJY] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check i-EP PCIe requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [IE_CFG_3] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check i-EP configuration space requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [B_PER_12] = {
             .test_entry_id    = P021_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Type 0 config header rules",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 21,
@@ -1570,14 +1380,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [XDGKZ] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = GPU,
-            .rule_desc        = "Check GPU devices",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [GPU_03] = {
             .test_entry_id    = P093_ENTRY,
             .module_id        = GPU,
-            .rule_desc        = "Switches must support ACS if P2P",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GPU_TEST_NUM_BASE + 01,
@@ -1585,7 +1393,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [GPU_04] = {
             .test_entry_id    = GPU_04_ENTRY,
             .module_id        = GPU,
-            .rule_desc        = "Check ATS support for RC and SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GPU_TEST_NUM_BASE + 02,
@@ -1593,7 +1400,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_ACS_1] = {
             .test_entry_id    = P082_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ACS Cap on p2p support - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 82,
@@ -1601,7 +1407,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_ACS_2] = {
             .test_entry_id    = P081_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check P2P Support - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 81,
@@ -1609,7 +1414,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_ORD_4] = {
             .test_entry_id    = E038_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Sec Bus Reset - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 38,
@@ -1617,35 +1421,30 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_REG_1] = {
             .test_entry_id    = IE_REG_1_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check config header rule - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [IE_REG_2] = {
             .test_entry_id    = IE_REG_2_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Dev Cap & Ctrl Reg rule - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [IE_REG_3] = {
             .test_entry_id    = IE_REG_3_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check config header rule - iEP RP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [IE_REG_4] = {
             .test_entry_id    = IE_REG_4_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check PCIe capability rules - iEP RP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [IE_REG_5] = {
             .test_entry_id    = P057_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Power Mgmt Cap/Ctrl/Status - iEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 57,
@@ -1653,7 +1452,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_REG_6] = {
             .test_entry_id    = P092_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Secondary PCIe ECap Check - iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 92,
@@ -1661,7 +1459,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_REG_7] = {
             .test_entry_id    = P012_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Datalink feature ECap Check - iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 12,
@@ -1669,7 +1466,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_REG_8] = {
             .test_entry_id    = P013_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Phy Layer 16GT/s ECap Check - iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 13,
@@ -1677,7 +1473,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_REG_9] = {
             .test_entry_id    = P014_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Phy Layer 16GT/s ECap Check - iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 14,
@@ -1685,7 +1480,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [IE_RST_2] = {
             .test_entry_id    = P079_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Sec Bus Reset - iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 79,
@@ -1693,7 +1487,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_03] = {
             .test_entry_id    = E011_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "MSI-capable device linked to ITS group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 11,
@@ -1701,7 +1494,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_04] = {
             .test_entry_id    = E035_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "MSI-cap device can target any ITS blk",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 35,
@@ -1709,7 +1501,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_05] = {
             .test_entry_id    = E012_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "MSI to ITS Blk outside assigned group",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 12,
@@ -1717,7 +1508,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_DEV_4] = {
             .test_entry_id    = E013_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "MSI originating from different master",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 13,
@@ -1725,7 +1515,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ITS_DEV_6] = {
             .test_entry_id    = E004_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Write to ITS GITS_TRANSLATER",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 4,
@@ -1733,7 +1522,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_01] = {
             .test_entry_id    = P010_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RP AER feature",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 10,
@@ -1741,7 +1529,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_04] = {
             .test_entry_id    = E023_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check AER functionality for RPs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 23,
@@ -1749,7 +1536,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_05] = {
             .test_entry_id    = P007_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RP DPC feature",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 7,
@@ -1757,7 +1543,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_06] = {
             .test_entry_id    = E024_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check DPC funcionality for RPs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 24,
@@ -1765,7 +1550,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_07] = {
             .test_entry_id    = E029_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "RAS ERR record for external abort",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 29,
@@ -1773,7 +1557,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_08] = {
             .test_entry_id    = E028_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "RAS ERR record for poisoned data",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 28,
@@ -1781,7 +1564,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_09] = {
             .test_entry_id    = P090_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RP Extensions for DPC",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 90,
@@ -1789,7 +1571,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_ER_10] = {
             .test_entry_id    = E027_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "DPC trig when RP-PIO unimplemented",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 27,
@@ -1797,14 +1578,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IC_11] = {
             .test_entry_id    = PCI_IC_11_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PCIe RC,PE - Same Inr Shareable Domain",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_IC_15] = {
             .test_entry_id    = E003_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Arrival order Check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 3,
@@ -1812,7 +1591,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_01] = {
             .test_entry_id    = P001_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ECAM Presence",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 1,
@@ -1820,7 +1598,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_02] = {
             .test_entry_id    = P002_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ECAM Memory accessibility",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 2,
@@ -1828,7 +1605,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_03] = {
             .test_entry_id    = P038_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check all RP in HB is in same ECAM",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 38,
@@ -1836,21 +1612,18 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_04] = {
             .test_entry_id    = PCI_IN_04_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "All EP/Sw under RP in same ECAM Region",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_IN_05] = {
             .test_entry_id    = PCI_IN_05_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Type 0/1 common config rule",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_IN_11] = {
             .test_entry_id    = E010_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RP Sec Bus transaction are TYPE0",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 10,
@@ -1858,7 +1631,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_12] = {
             .test_entry_id    = P037_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Config Txn for RP in HB",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 37,
@@ -1866,14 +1638,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_13] = {
             .test_entry_id    = PCI_IN_13_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RootPort NP Memory Access",
             .platform_bitmask = PLATFORM_BAREMETAL,
             .flag             = BASE_RULE,
         },
         [PCI_IN_16] = {
             .test_entry_id    = P008_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check all 1's for out of range",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 8,
@@ -1881,14 +1651,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_17] = {
             .test_entry_id    = PCI_IN_17_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ARI forwarding enable rule",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_IN_18] = {
             .test_entry_id    = P011_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RP Byte Enable Rules",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 11,
@@ -1896,14 +1664,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_IN_19] = {
             .test_entry_id    = PCI_IN_19_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Cmd Reg memory space enable",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_IN_20] = {
             .test_entry_id    = P009_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Vendor specific data is PCIe compliant",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 9,
@@ -1911,42 +1677,36 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_LI_01] = {
             .test_entry_id    = PCI_LI_01_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Legacy Interrupt is SPI",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_LI_02] = {
             .test_entry_id    = PCI_LI_02_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PCI legacy intr SPI ID unique",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = BASE_RULE,
         },
         [PCI_LI_03] = {
             .test_entry_id    = PCI_LI_03_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Legacy Intr SPI level sensitive",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_MM_01] = {
             .test_entry_id    = PCI_MM_01_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PCIe Device Memory mapping support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = BASE_RULE,
         },
         [PCI_MM_03] = {
             .test_entry_id    = PCI_MM_03_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PCIe Normal Memory mapping support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = BASE_RULE,
         },
         [PCI_MM_04] = {
             .test_entry_id    = P047_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "NP type-1 pcie only support 32-bit",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 47,
@@ -1954,7 +1714,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_MM_05] = {
             .test_entry_id    = P095_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PCIe & PE common physical memory view",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 95,
@@ -1962,7 +1721,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_MM_07] = {
             .test_entry_id    = P105_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "No extra address translation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 105,
@@ -1970,7 +1728,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_MSI_1] = {
             .test_entry_id    = P039_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check MSI support for PCIe dev",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 39,
@@ -1978,14 +1735,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_MSI_2] = {
             .test_entry_id    = PCI_MSI_2_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check MSI(X) vectors uniqueness",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = BASE_RULE,
         },
         [PCI_PAS_1] = {
             .test_entry_id    = P042_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PASID support atleast 16 bits",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 42,
@@ -1993,7 +1748,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_PP_02] = {
             .test_entry_id    = E014_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "P2P transactions must not deadlock",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 14,
@@ -2001,7 +1755,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_PP_03] = {
             .test_entry_id    = P019_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "RP must suprt ACS if P2P Txn are allow",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 19,
@@ -2009,21 +1762,18 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [PCI_PP_04] = {
             .test_entry_id    = PCI_PP_04_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check P2P ACS Functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_PP_05] = {
             .test_entry_id    = PCI_PP_05_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Direct Transl P2P Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [PCI_SM_02] = {
             .test_entry_id    = P035_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Function level reset",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 35,
@@ -2031,7 +1781,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L4PCI_2] = {
             .test_entry_id    = P087_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check EA Capability",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 87,
@@ -2039,7 +1788,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_ACS_1] = {
             .test_entry_id    = P015_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ACS Cap on p2p support - RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 15,
@@ -2047,7 +1795,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_ACS_2] = {
             .test_entry_id    = P016_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check AER Cap on ACS Cap support - RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 16,
@@ -2055,7 +1802,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_BAR_1] = {
             .test_entry_id    = P083_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Read and write to BAR reg - RCiEP, iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 83,
@@ -2063,7 +1809,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_BAR_3] = {
             .test_entry_id    = P062_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check BAR memory space & type - RCiEP, iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 62,
@@ -2071,7 +1816,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_INT_1] = {
             .test_entry_id    = P069_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check MSI and MSI-X support - RCiEP, iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 69,
@@ -2079,7 +1823,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_ORD_1] = {
             .test_entry_id    = E021_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Arrival order & Gathering Check - RCiEP, iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE  +  21,
@@ -2087,7 +1830,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_ORD_4] = {
             .test_entry_id    = E008_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Tx pending bit clear correctness - RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE  +  8,
@@ -2095,7 +1837,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_PCI_1] = {
             .test_entry_id    = P085_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Hdr type & link Cap - RCiEP, RCEC",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 85,
@@ -2103,7 +1844,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_PCI_2] = {
             .test_entry_id    = P084_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Class code and Ext Cap - RCEC",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 84,
@@ -2111,7 +1851,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_PWR_1] = {
             .test_entry_id    = P070_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Power Mgmt rules - RCiEP, iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 70,
@@ -2119,21 +1858,18 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_REC_1] = {
             .test_entry_id    = RE_REC_1_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Dev Cap & Ctrl Reg rule - RCEC",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [RE_REG_1] = {
             .test_entry_id    = RE_REG_1_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check config header rule - RCEC, RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [RE_REG_2] = {
             .test_entry_id    = P056_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check PWR Mgmt Cap/Ctrl/Status - RCEC, RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 56,
@@ -2141,7 +1877,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RE_REG_3] = {
             .test_entry_id    = P052_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Dev Cap & Ctrl Reg rule - RCiEP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 52,
@@ -2149,7 +1884,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_RST_1] = {
             .test_entry_id    = P063_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Function level reset - RCiEP, iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 63,
@@ -2157,7 +1891,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_SMU_1] = {
             .test_entry_id    = RI_SMU_1_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ATS Support Rule -  RCiEP, iEP Pair",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 19,
@@ -2165,7 +1898,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [RI_SMU_3] = {
             .test_entry_id    = E036_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Generate PASID transactions - RCiEP, iEP EP",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE  +  36,
@@ -2173,14 +1905,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L6PCI_1] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check PCIe On-chip Peripherals",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
         [S_PCIe_02] = {
             .test_entry_id    = P086_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check RootPort P&NP Memory Access",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 86,
@@ -2188,7 +1918,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_PCIe_03] = {
             .test_entry_id    = E022_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "PE 2/4/8B writes to PCIe as 2/4/8B",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 22,
@@ -2196,7 +1925,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_PCIe_04] = {
             .test_entry_id    = E025_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check 2/4/8 Bytes targeted writes",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 25,
@@ -2204,7 +1932,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_PCIe_07] = {
             .test_entry_id    = E026_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check Inbound writes seen in order",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 26,
@@ -2212,7 +1939,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_PCIe_08] = {
             .test_entry_id    = E032_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check ordered writes flush prev writes",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE  +  32,
@@ -2220,7 +1946,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PCIe_10] = {
             .test_entry_id    = E030_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Enable and disable STE.DCP bit",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_EXERCISER_TEST_NUM_BASE + 30,
@@ -2228,7 +1953,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [B_PCIe_11] = {
             .test_entry_id    = P091_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Steering Tag value properties",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 91,
@@ -2236,7 +1960,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [BJLPB] = {
             .test_entry_id    = P100_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check MSI/MSI-X if FRS is supported",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 100,
@@ -2244,7 +1967,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_PCIe_10] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "STE.DCP control & Steering Tag properties",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI | PLATFORM_LINUX,
             .flag             = ALIAS_RULE,
         },
@@ -2252,7 +1974,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7MP_01] = {
             .test_entry_id    = MPAM001_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check for MPAM extension",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MPAM_TEST_NUM_BASE + 1,
@@ -2260,7 +1981,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7MP_02] = {
             .test_entry_id    = MPAM008_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check for MPAM partition IDs ",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MPAM_TEST_NUM_BASE + 8,
@@ -2268,14 +1988,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7MP_03] = {
             .test_entry_id    = S_L7MP_03_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check MPAM LLC Requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [S_L7MP_04] = {
             .test_entry_id    = MPAM009_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check for MPAM LLC CSU Monitor count",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MPAM_TEST_NUM_BASE + 2,
@@ -2283,7 +2001,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7MP_05] = {
             .test_entry_id    = MPAM003_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check for MPAM MBWUs Monitor func",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MPAM_TEST_NUM_BASE + 3,
@@ -2291,7 +2008,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L7MP_08] = {
             .test_entry_id    = MPAM005_ENTRY,
             .module_id        = MPAM,
-            .rule_desc        = "Check for MPAM MSC address overlap",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_MPAM_TEST_NUM_BASE + 5,
@@ -2300,7 +2016,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_02] = {
             .test_entry_id    = ETE001_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check for FEAT_ETE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 1,
@@ -2308,7 +2023,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_03] = {
             .test_entry_id    = ETE002_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check trace unit ETE supports",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 2,
@@ -2316,7 +2030,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_04] = {
             .test_entry_id    = ETE003_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check ETE Same Trace Timestamp Source",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 3,
@@ -2324,7 +2037,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_05] = {
             .test_entry_id    = ETE004_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check Trace Same Timestamp Source",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 4,
@@ -2332,7 +2044,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_06] = {
             .test_entry_id    = ETE009_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check Concurrent Trace Generation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 9,
@@ -2340,7 +2051,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_07] = {
             .test_entry_id    = ETE005_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check for FEAT_TRBE",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 5,
@@ -2348,7 +2058,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_08] = {
             .test_entry_id    = ETE006_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check trace buffers flag updates",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 6,
@@ -2356,7 +2065,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_09] = {
             .test_entry_id    = ETE007_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check TRBE trace buffers alignment",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 7,
@@ -2364,7 +2072,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [ETE_10] = {
             .test_entry_id    = ETE008_ENTRY,
             .module_id        = ETE,
-            .rule_desc        = "Check GICC TRBE Interrupt field",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_ETE_TEST_NUM_BASE + 8,
@@ -2374,7 +2081,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1GI_01] = {
             .test_entry_id    = G012_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GIC version",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 12,
@@ -2382,7 +2088,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PP_01] = {
             .test_entry_id    = G014_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check All PPI Interrupt IDs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE + 14,
@@ -2390,7 +2095,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1GI_03] = {
             .test_entry_id    = INTERFACE010_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GIC supports disabling LPIs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE  +  10,
@@ -2398,7 +2102,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1GI_04] = {
             .test_entry_id    = INTERFACE011_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check GICR_PENDBASER when LPIs enabled",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_GIC_TEST_NUM_BASE  +  11,
@@ -2406,21 +2109,18 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1MM_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "NS-EL2 Stage-2 64KB Mapping Check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [P_L1PE_01] = {
             .test_entry_id    = P_L1PE_01_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PE 4KB Granule Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
         },
         [P_L1PE_02] = {
             .test_entry_id    = PE024_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for 16-bit ASID support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  24,
@@ -2428,7 +2128,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_03] = {
             .test_entry_id    = PE025_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check AARCH64 implementation",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  25,
@@ -2436,7 +2135,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_04] = {
             .test_entry_id    = PE015_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for FEAT_LSE support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  15,
@@ -2444,7 +2142,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_05] = {
             .test_entry_id    = PE026_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check FEAT_LPA Requirements",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 26,
@@ -2452,7 +2149,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_06] = {
             .test_entry_id    = PE028_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check DC CVAP support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE + 28,
@@ -2460,7 +2156,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_07] = {
             .test_entry_id    = PE029_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for 16-Bit VMID",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 29,
@@ -2468,7 +2163,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PE_08] = {
             .test_entry_id    = PE030_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check for Virtual host extensions",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  + 30,
@@ -2476,7 +2170,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1SM_02] = {
             .test_entry_id    = I008_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check Stage 1 SMMUv3 functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 8,
@@ -2484,7 +2177,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1SM_03] = {
             .test_entry_id    = I025_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check Stage 2 SMMUv3 functionality",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 25,
@@ -2492,7 +2184,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1SM_04] = {
             .test_entry_id    = I020_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU Coherent Access Support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 20,
@@ -2500,7 +2191,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1SM_05] = {
             .test_entry_id    = I022_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check if all DMA reqs behind SMMU",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 22,
@@ -2508,14 +2198,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L2WD_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = WATCHDOG,
-            .rule_desc        = "Non-secure Generic watchdog check",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [P_L1TP_01] = {
             .test_entry_id    = TPM001_ENTRY,
             .module_id        = TPM,
-            .rule_desc        = "Check TPM Version",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TPM2_TEST_NUM_BASE  +  1,
@@ -2523,7 +2211,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1TP_03] = {
             .test_entry_id    = TPM002_ENTRY,
             .module_id        = TPM,
-            .rule_desc        = "Check TPM interface locality support",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TPM2_TEST_NUM_BASE  +  2,
@@ -2531,7 +2218,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1GI_02] = {
             .test_entry_id    = P046_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check all MSI(X) vectors are LPIs",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 46,
@@ -2539,7 +2225,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [P_L1PCI_2] = {
             .test_entry_id    = P087_ENTRY,
             .module_id        = PCIE,
-            .rule_desc        = "Check EA Capability",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PCIE_TEST_NUM_BASE + 87,
@@ -2548,28 +2233,24 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1PE_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check vPE architectural compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L1PE_02] = {
             .test_entry_id    = V_L1PE_02_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check PMUv3 support in vPE",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE
         },
         [V_L1MM_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "Check VE Mem architectural compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L1MM_02] = {
             .test_entry_id    = M004_ENTRY,
             .module_id        = MEM_MAP,
-            .rule_desc        = "DMA requestors access to NS addr space",
             .platform_bitmask = PLATFORM_LINUX,
             .flag             = BASE_RULE,
             .test_num         = ACS_MEMORY_MAP_TEST_NUM_BASE + 4,
@@ -2577,28 +2258,24 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1GI_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check vGIC architectural compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L1PP_00] = {
             .test_entry_id    = V_L1PP_00_ENTRY,
             .module_id        = GIC,
-            .rule_desc        = "Check VE PPI assignment mapping",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE
         },
         [V_L1SM_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check vSMMU architectural compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L1SM_02] = {
             .test_entry_id    = I031_ENTRY,
             .module_id        = SMMU,
-            .rule_desc        = "Check SMMU stage 1 support for VE",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_SMMU_TEST_NUM_BASE + 31,
@@ -2606,7 +2283,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1TM_01] = {
             .test_entry_id    = T001_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check Virt and Phy counter presence",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 1,
@@ -2614,7 +2290,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1TM_02] = {
             .test_entry_id    = T007_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check Virt and Phy counter min freq",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 7,
@@ -2622,7 +2297,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1TM_04] = {
             .test_entry_id    = T008_ENTRY,
             .module_id        = TIMER,
-            .rule_desc        = "Check uniform passage of time in VE",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_TIMER_TEST_NUM_BASE + 8,
@@ -2630,35 +2304,30 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L1WK_02] = {
             .test_entry_id    = V_L1WK_02_05_ENTRY,
             .module_id        = POWER_WAKEUP,
-            .rule_desc        = "Check power wakeup interrupts",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE
         },
         [V_L1WK_05] = {
             .test_entry_id    = V_L1WK_02_05_ENTRY,
             .module_id        = POWER_WAKEUP,
-            .rule_desc        = "Check vPE power state semantics",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE
         },
         [V_L1PR_01] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check Peripheral arch compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L1PR_02] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = PERIPHERAL,
-            .rule_desc        = "Check Virt PCIe arch compliance",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = ALIAS_RULE
         },
         [V_L2PE_01] = {
             .test_entry_id    = PE068_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check num PMU counters for vPEs",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  68,
@@ -2666,7 +2335,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [V_L2PE_02] = {
             .test_entry_id    = PE010_ENTRY,
             .module_id        = PE,
-            .rule_desc        = "Check vPE PMU overflow signal",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PE_TEST_NUM_BASE  +  10,
@@ -2675,7 +2343,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0053] = {
             .test_entry_id    = PFDI001_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI Version is returned",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 1,
@@ -2683,7 +2350,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0104] = {
             .test_entry_id    = PFDI002_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI Version in All PE's",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 2,
@@ -2691,7 +2357,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0102] = {
             .test_entry_id    = PFDI003_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI mandatory functions",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 3,
@@ -2699,7 +2364,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0060] = {
             .test_entry_id    = PFDI004_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI Feature function support",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 4,
@@ -2707,7 +2371,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0066] = {
             .test_entry_id    = PFDI005_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE HW test mechanism info",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 5,
@@ -2715,7 +2378,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0071] = {
             .test_entry_id    = PFDI006_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check num of Test Part supported",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 6,
@@ -2723,7 +2385,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0076] = {
             .test_entry_id    = PFDI007_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Execute Test Parts and All Parts on PE",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 7,
@@ -2731,7 +2392,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0082] = {
             .test_entry_id    = PFDI008_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Query PE boot test status",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 8,
@@ -2739,7 +2399,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0089] = {
             .test_entry_id    = PFDI009_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Query PFDI firmware check on all PEs",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 9,
@@ -2747,7 +2406,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0156] = {
             .test_entry_id    = PFDI010_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI reserved function support check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 10,
@@ -2755,7 +2413,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0040] = {
             .test_entry_id    = PFDI011_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check if X5 to X17 are preserved",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 11,
@@ -2763,7 +2420,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0099] = {
             .test_entry_id    = PFDI012_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI forced error injection",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 12,
@@ -2771,7 +2427,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0164] = {
             .test_entry_id    = PFDI013_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE Run with Start exceeds End",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 13,
@@ -2779,7 +2434,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0165] = {
             .test_entry_id    = PFDI014_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE Run with Start exceeds max",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 14,
@@ -2787,7 +2441,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0100] = {
             .test_entry_id    = PFDI015_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI recovery after forced error",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 15,
@@ -2795,7 +2448,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0157] = {
             .test_entry_id    = PFDI016_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI feature for invalid function",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 16,
@@ -2803,7 +2455,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0154] = {
             .test_entry_id    = PFDI017_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PFDI unsupported function",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 17,
@@ -2811,7 +2462,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0166] = {
             .test_entry_id    = PFDI018_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE Run with End exceeds max index",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 18,
@@ -2819,7 +2469,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0167] = {
             .test_entry_id    = PFDI019_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE Run with Start or End equals -1",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 19,
@@ -2827,7 +2476,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0168] = {
             .test_entry_id    = PFDI020_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check PE Run with Start or End less -1",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 20,
@@ -2835,7 +2483,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0155] = {
             .test_entry_id    = PFDI021_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI version invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 21,
@@ -2843,7 +2490,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0179] = {
             .test_entry_id    = PFDI022_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Feature invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 22,
@@ -2851,7 +2497,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0158] = {
             .test_entry_id    = PFDI023_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI PE Test ID invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 23,
@@ -2859,7 +2504,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0160] = {
             .test_entry_id    = PFDI024_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Test Part Count invalid params",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 24,
@@ -2867,7 +2511,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0172] = {
             .test_entry_id    = PFDI025_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI PE Test Result invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 25,
@@ -2875,7 +2518,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0173] = {
             .test_entry_id    = PFDI026_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Firmware Check invalid params",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 26,
@@ -2883,7 +2525,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0193] = {
             .test_entry_id    = PFDI027_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check FORCE ERROR overwrite behavior",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 27,
@@ -2891,7 +2532,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0194] = {
             .test_entry_id    = PFDI028_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "Check FORCE ERROR PE locality behavior",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 28,
@@ -2899,7 +2539,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0163] = {
             .test_entry_id    = PFDI029_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Test Run invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 29,
@@ -2907,7 +2546,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0180] = {
             .test_entry_id    = PFDI030_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Force Error invalid params check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 30,
@@ -2915,7 +2553,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [R0176] = {
             .test_entry_id    = PFDI031_ENTRY,
             .module_id        = PFDI,
-            .rule_desc        = "PFDI Force Error invalid function ID check",
             .platform_bitmask = PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_PFDI_TEST_NUM_BASE + 31,
@@ -2924,14 +2561,12 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [S_L8CXL_1] = {
             .test_entry_id    = NULL_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "CXL Rules",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = ALIAS_RULE,
         },
         [CXL_01] = {
             .test_entry_id    = CXL001_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CXL Version",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  1,
@@ -2939,7 +2574,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_02] = {
             .test_entry_id    = CXL_02_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CXL Type1/2 SMMU ATS",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  2,
@@ -2947,7 +2581,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_03] = {
             .test_entry_id    = CXL003_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CHBCR address map",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  3,
@@ -2955,7 +2588,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_04] = {
             .test_entry_id    = CXL004_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Validate CHBCR capability registers",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  4,
@@ -2963,7 +2595,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_05] = {
             .test_entry_id    = E044_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "CXL root port PMReq/PMRes VDM handling",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  5,
@@ -2971,7 +2602,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_06] = {
             .test_entry_id    = E045_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "CXL host sink for incoming MEFN VDM",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  6,
@@ -2979,7 +2609,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_09] = {
             .test_entry_id    = E043_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "CXL.mem write transaction",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  9,
@@ -2987,7 +2616,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_10] = {
             .test_entry_id    = CXL010_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check PCMO for CXL persistent memory",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  10,
@@ -2995,7 +2623,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_11] = {
             .test_entry_id    = CXL_11_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CXL.mem writeback and AER status",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  11,
@@ -3003,7 +2630,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_12] = {
             .test_entry_id    = CXL_12_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CXL.cache coherency with exerciser",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  12,
@@ -3011,7 +2637,6 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         [CXL_13] = {
             .test_entry_id    = CXL013_ENTRY,
             .module_id        = CXL,
-            .rule_desc        = "Check CXL Type-3 mandatory atomic features",
             .platform_bitmask = PLATFORM_BAREMETAL | PLATFORM_UEFI,
             .flag             = BASE_RULE,
             .test_num         = ACS_CXL_TEST_NUM_BASE  +  13,
@@ -3433,6 +3058,405 @@ rule_test_map_t rule_test_map[RULE_ID_SENTINEL] = {
         },
     };
 
+/* Rule descriptions, kept apart from rule_test_map so that the table indexed
+ * while running rules stays compact. Indexed by RULE_ID_e, NULL if none.
+ */
+const char8_t *rule_desc_string[RULE_ID_SENTINEL] = {
+    [S_L3_01] = "BSA Level 1 requirements",
+    [P_L1_01] = "BSA Level 1 requirements",
+    /*PE*/
+    [B_PE_01] = "Check Arch symmetry across PE",
+    [B_PE_02] = "Check for number of PE",
+    [B_PE_03] = "Check for AdvSIMD and FP support",
+    [B_PE_04] = "Check PE 4KB Granule Support",
+    [B_PE_06] = "Check Cryptographic extensions",
+    [B_PE_07] = "Check Little Endian support",
+    [B_PE_08] = "Check EL1 and EL0 implementation",
+    [B_PE_09] = "Check for PMU and PMU counters",
+    [B_PE_10] = "Check PMU Overflow signal",
+    [B_PE_11] = "Check num of Breakpoints and type",
+    [B_PE_12] = "Check Synchronous Watchpoints",
+    [B_PE_13] = "Check CRC32 instruction support",
+    [B_PE_14] = "Check SVE2 for v9 PE",
+    [B_PE_18] = "Check EL2 implementation",
+    [B_PE_19] = "Check Stage 2 4KB Granule Support",
+    [B_PE_20] = "Check Stage2 and Stage1 Granule match",
+    [B_PE_21] = "Check for PMU counters",
+    [B_PE_22] = "Check VMID breakpoint number",
+    [B_PE_23] = "Check for EL3 AArch64 support",
+    [B_PE_24] = "Check for Secure state implementation",
+    [B_PE_17] = "Check SPE if implemented",
+    [B_PE_25] = "Check for FEAT_LSE support",
+    [XRPZG] = "Check num of Breakpoints and type",
+    [B_SEC_01] = "Check Speculation Restriction",
+    [B_SEC_02] = "Check Speculative Str Bypass Safe",
+    [B_SEC_03] = "Check PEs Impl CSDB,SSBB,PSSBB",
+    [B_SEC_04] = "Check PEs Implement SB Barrier",
+    [B_SEC_05] = "Check PE Impl CFP,DVP,CPP RCTX",
+    [S_L3PE_01] = "Check PE Granule Support",
+    [S_L3PE_02] = "Check for 16-bit ASID support",
+    [S_L3PE_03] = "Check AARCH64 implementation",
+    [S_L3PE_04] = "Check FEAT_LPA Requirements",
+    [S_L4PE_01] = "Check for RAS extension",
+    [S_L4PE_02] = "Check DC CVAP support",
+    [S_L4PE_03] = "Check for 16-Bit VMID",
+    [S_L4PE_04] = "Check for Virtual host extensions",
+    [S_L5PE_01] = "Support Page table map size change",
+    [S_L5PE_02] = "Check for addr and generic auth",
+    [S_L5PE_04] = "Check Activity monitors extension",
+    [S_L5PE_05] = "Check for SHA3 and SHA512 support",
+    [S_L5PE_06] = "Stage 2 control of mem and cache",
+    [S_L5PE_07] = "Check for nested virtualization",
+    [S_L6PE_01] = "Check PE security features",
+    [S_L6PE_02] = "Check Branch Target Support",
+    [S_L6PE_03] = "Check Protect Against Timing Fault",
+    [S_L6PE_04] = "Check PMU Version v3.5 or higher",
+    [S_L6PE_05] = "Check AccessFlag DirtyState Update",
+    [S_L6PE_06] = "Check Enhanced Virtualization Trap",
+    [S_L7PE_01] = "Check Fine Grain Trap Support",
+    [S_L6PE_08] = "Check SPE if implemented",
+    [S_L7PE_02] = "Check for ECV support",
+    [S_L7PE_04] = "Checks ASIMD Int8 matrix multiplc",
+    [S_L7PE_05] = "Check for BFLOAT16 extension",
+    [S_L7PE_06] = "Check PAuth2, FPAC & FPACCOMBINE",
+    [S_L7PE_07] = "Check for SVE Int8 matrix multiple",
+    [S_L8PE_01] = "Check XS attribute functionality",
+    [S_L8PE_02] = "Check WFET and WFIT functionality",
+    [S_L8PE_03] = "Check atomic 64 byte store support",
+    [S_L8PE_04] = "Check for enhanced PAN feature",
+    [S_L8PE_05] = "Check PMU Version v3.7 or higher",
+    [S_L8PE_06] = "Check for FEAT_BRBE support",
+    [S_L8PE_07] = "Check for unsupported PBHA bits",
+    [WNPXD] = "Check for FEAT_PFAR support",
+    /* GIC */
+    [B_GIC_01] = "Check GIC version",
+    [B_GIC_02] = "Check GICv2 Valid Configuration",
+    [B_GIC_03] = "If PCIe, GICv3 then ITS, LPI",
+    [B_GIC_04] = "Check GICv3 Security States",
+    [B_GIC_05] = "Non-secure SGIs are implemented",
+    [ITS_01] = "Check number of ITS blocks in a group",
+    [ITS_02] = "Check ITS block association with group",
+    [ITS_DEV_2] = "Check uniqueness of StreamID",
+    [ITS_DEV_7] = "Check Device's SID/RID/DID behind SMMU",
+    [ITS_DEV_8] = "Check Device IDs not behind SMMU",
+    [S_L3GI_01] = "Check GIC version",
+    [S_L3GI_02] = "Check all MSI(X) vectors are LPIs",
+    [B_PPI_00] = "PPI Assignments check",
+    [S_L3PP_01] = "Check All PPI Interrupt IDs",
+    [S_L5GI_01] = "Check Non standard GICv3 implmentation",
+    [S_L5PP_01] = "Check Reserved PPI Assignments",
+    [S_L8GI_01] = "Check GICv4.1 or higher compliant",
+    [Appendix_I_5] = "Check GICv2m SPI allocated to MSI Ctrl",
+    [Appendix_I_6] = "",
+    [Appendix_I_9] = "Check GICv2m MSI Frame Register",
+    /* PERIPHERAL */
+    [B_PER_01] = "USB CTRL Interface EHCI check",
+    [B_PER_02] = "USB CTRL Interface XHCI check",
+    [B_PER_03] = "Check SATA CTRL Interface",
+    [B_PER_05] = "Check UART type Arm Generic or 16550",
+    [S_L3PR_01] = "Check UART Arm Generic or 16550 presence",
+    [B_PER_06] = "Check ARM Generic UART Interrupt",
+    [B_PER_08] = "Check PCI Express root complex",
+    [B_PER_09] = "Check Memory Attributes of DMA",
+    [B_PER_10] = "Check DMA for I/O coherency",
+    /* MEM_MAP */
+    [B_MEM_01] = "Mem Access Response in finite time",
+    [B_MEM_02] = "Memory Access to Un-Populated addr",
+    [B_MEM_03] = "Check Addressability",
+    [B_MEM_04] = "Check dev DMA behind SMMU",
+    [B_MEM_06] = "Check NS non-64b DMA devices are behind SMMU",
+    [B_MEM_05] = "PE must access all NS addr space",
+    [S_L3MM_01] = "NS-EL2 Stage-2 64KB Mapping Check",
+    [S_L3MM_02] = "Check peripherals addr 64Kb apart",
+    /* PMU */
+    [PMU_PE_01] = "Check Performance Monitors Extension",
+    [PMU_PE_02] = "Check PMU Overflow signal",
+    [PMU_PE_03] = "Check number of PMU counters",
+    [PMU_SYS_1] = "Test Simultaneous 4 traffic measures",
+    [PMU_SYS_2] = "Test Simultaneous 6 traffic measures",
+    [PMU_SYS_5] = "Check System PMU for NUMA systems",
+    [PMU_SYS_6] = "Check multiple type traffic measurement",
+    [PMU_BM_1] = "Check for memory bandwidth monitors",
+    [PMU_MEM_1] = "Check for memory latency monitors",
+    [PMU_BM_2] = "Check for PCIe bandwidth monitors",
+    [PMU_EV_11] = "Check for multi-threaded PMU ext",
+    [PMU_SPE] = "Check for PMU SPE Requirements",
+    [S_L7PMU] = "Check for PMU Features",
+    [S_L8SHD_1] = "Check for ETE Features",
+    /* RAS */
+    [RAS_01] = "Check Error Counter",
+    [RAS_02] = "Check CFI, DUI, UI Controls",
+    [RAS_03] = "Check FHI in Error Record Group",
+    [RAS_04] = "Check ERI in Error Record Group",
+    [RAS_06] = "Check ERI/FHI Connected to GIC",
+    [RAS_07] = "RAS ERR<n>ADDR.AI bit status check",
+    [RAS_08] = "Check Error Group Status",
+    [RAS_11] = "Software Fault Error Check",
+    [S_L7RAS_1] = "Data abort on Containable err",
+    [S_RAS_01] = "Check RAS SR Interface ERI/FHI are PPI",
+    [SYS_RAS] = "Check Server RAS requirements",
+    [SYS_RAS_1] = "Check for patrol scrubbing support",
+    [SYS_RAS_2] = "Check Poison Storage & Forwarding",
+    [SYS_RAS_3] = "Check Error when Poison unsupported",
+    [SYS_RAS_4] = "Check RAS memory mapped view supp",
+    [LVQBC] = "Check RASSA_RV, RASSA_DFI, CED supp",
+    [ZVDJG] = "Check FEAT_RASSA_RV implementation",
+    [RKLPK] = "Check FEAT_RASSA_DFI and CED support",
+    [KBRZG] = "Data abort on containable Device err",
+    /* SMMU */
+    [B_SMMU_01] = "All SMMUs have same Arch Revision",
+    [B_SMMU_02] = "Check SMMU Granule Support",
+    [B_SMMU_03] = "Check SMMU Large VA Support",
+    [B_SMMU_04] = "Check TLB Range Invalidation",
+    [B_SMMU_05] = "Check DVM capabilities",
+    [B_SMMU_06] = "Check SMMU Large Physical Addr Support",
+    [B_SMMU_08] = "Check SMMU S-EL2 & stage1 support",
+    [B_SMMU_09] = "Check S-EL2 & SMMU Stage1 support",
+    [B_SMMU_11] = "Check SMMU for MPAM support",
+    [B_SMMU_13] = "Check SMMU 16 Bit ASID Support",
+    [B_SMMU_14] = "Check SMMU Endianess Support",
+    [B_SMMU_16] = "Check SMMUs stage2 support",
+    [B_SMMU_18] = "Check SMMU S-EL2 & stage2 support",
+    [B_SMMU_19] = "SMMUv2 unique intr per ctxt bank",
+    [B_SMMU_20] = "Check S-EL2 & SMMU Stage2 Support",
+    [B_SMMU_21] = "SMMUv3 Integration compliance",
+    [B_SMMU_23] = "Check SMMU 16 Bit VMID Support",
+    [SMMU_01] = "SMMUv3 Integration compliance",
+    [S_L4SM_01] = "Check Stage 1 SMMUv3 functionality",
+    [S_L4SM_02] = "Check Stage 2 SMMUv3 functionality",
+    [S_L4SM_03] = "Check SMMU Coherent Access Support",
+    [S_L5SM_01] = "Check SMMUv3.2 or higher",
+    [S_L5SM_02] = "Check SMMU L1 and L2 table resizing",
+    [S_L5SM_03] = "Check SMMU for MPAM support",
+    [S_L5SM_04] = "S-EL2 & SMMU Stage1 and Stage2 support",
+    [S_L6SM_02] = "Check SMMU HTTU Support",
+    [S_L6SM_03] = "Check SMMU MSI Support",
+    [S_L6SM_04] = "Check SMMU large VA/TLB/DVM ASID VMID",
+    [S_L7SM_01] = "Check if all DMA reqs behind SMMU",
+    [S_L7SM_02] = "Check for SMMU/CATU in ETR Path",
+    [S_L7SM_03] = "Check SMMU PMU Extension presence",
+    [S_L7SM_04] = "Check SMMU PMCG has >= 4 counters",
+    [S_L8SM_01] = "Check SMMUv3.3 or higher",
+    /* TIMER */
+    [B_TIME_01] = "Check for Generic System Counter",
+    [B_TIME_02] = "Check System Counter Frequency",
+    [B_TIME_06] = "SYS Timer if PE Timer not ON",
+    [B_TIME_07] = "Memory mapped timer check",
+    [B_TIME_08] = "Generate Mem Mapped SYS Timer Intr",
+    [B_TIME_09] = "Restore PE timer on PE wake up",
+    [S_L8TI_01] = "Check Minimum Counter Frequency 50MHz",
+    /* WATCHDOG */
+    [B_WD_00] = "Generic watchdog check",
+    [B_WD_01] = "Non Secure Watchdog Access ",
+    [B_WD_02] = "Non Secure Watchdog Access ",
+    [B_WD_03] = "Check Watchdog WS0 interrupt ",
+    [S_L3WD_01] = "Non-secure Generic watchdog check",
+    [S_L6WD_01] = "Check NS Watchdog Revision",
+    /* NIST */
+    [S_L7ENT_1] = "NIST Statistical Test Suite",
+    /* POWER WAKEUP*/
+    [B_WAK_03] = "Check power wakeup interrupts",
+    [B_WAK_07] = "Check power wakeup interrupts",
+    /* PCIE */
+    [B_REP_1] = "Check RCiEP Devices",
+    [JKZMT] = "Check RCiEP and RCEC PCIe requirements",
+    [B_IEP_1] = "Check i-EP Devices",
+    [HVZJY] = "Check i-EP PCIe requirements",
+    [IE_CFG_3] = "Check i-EP configuration space requirements",
+    [B_PER_12] = "Type 0 config header rules",
+    [XDGKZ] = "Check GPU devices",
+    [GPU_03] = "Switches must support ACS if P2P",
+    [GPU_04] = "Check ATS support for RC and SMMU",
+    [IE_ACS_1] = "Check ACS Cap on p2p support - iEP EP",
+    [IE_ACS_2] = "Check P2P Support - iEP EP",
+    [IE_ORD_4] = "Check Sec Bus Reset - iEP EP",
+    [IE_REG_1] = "Check config header rule - iEP EP",
+    [IE_REG_2] = "Check Dev Cap & Ctrl Reg rule - iEP EP",
+    [IE_REG_3] = "Check config header rule - iEP RP",
+    [IE_REG_4] = "Check PCIe capability rules - iEP RP",
+    [IE_REG_5] = "Check Power Mgmt Cap/Ctrl/Status - iEP",
+    [IE_REG_6] = "Secondary PCIe ECap Check - iEP Pair",
+    [IE_REG_7] = "Datalink feature ECap Check - iEP Pair",
+    [IE_REG_8] = "Phy Layer 16GT/s ECap Check - iEP Pair",
+    [IE_REG_9] = "Phy Layer 16GT/s ECap Check - iEP Pair",
+    [IE_RST_2] = "Check Sec Bus Reset - iEP EP",
+    [ITS_03] = "MSI-capable device linked to ITS group",
+    [ITS_04] = "MSI-cap device can target any ITS blk",
+    [ITS_05] = "MSI to ITS Blk outside assigned group",
+    [ITS_DEV_4] = "MSI originating from different master",
+    [ITS_DEV_6] = "Write to ITS GITS_TRANSLATER",
+    [PCI_ER_01] = "Check RP AER feature",
+    [PCI_ER_04] = "Check AER functionality for RPs",
+    [PCI_ER_05] = "Check RP DPC feature",
+    [PCI_ER_06] = "Check DPC funcionality for RPs",
+    [PCI_ER_07] = "RAS ERR record for external abort",
+    [PCI_ER_08] = "RAS ERR record for poisoned data",
+    [PCI_ER_09] = "Check RP Extensions for DPC",
+    [PCI_ER_10] = "DPC trig when RP-PIO unimplemented",
+    [PCI_IC_11] = "PCIe RC,PE - Same Inr Shareable Domain",
+    [PCI_IC_15] = "Arrival order Check",
+    [PCI_IN_01] = "Check ECAM Presence",
+    [PCI_IN_02] = "Check ECAM Memory accessibility",
+    [PCI_IN_03] = "Check all RP in HB is in same ECAM",
+    [PCI_IN_04] = "All EP/Sw under RP in same ECAM Region",
+    [PCI_IN_05] = "Type 0/1 common config rule",
+    [PCI_IN_11] = "Check RP Sec Bus transaction are TYPE0",
+    [PCI_IN_12] = "Check Config Txn for RP in HB",
+    [PCI_IN_13] = "Check RootPort NP Memory Access",
+    [PCI_IN_16] = "Check all 1's for out of range",
+    [PCI_IN_17] = "Check ARI forwarding enable rule",
+    [PCI_IN_18] = "Check RP Byte Enable Rules",
+    [PCI_IN_19] = "Check Cmd Reg memory space enable",
+    [PCI_IN_20] = "Vendor specific data is PCIe compliant",
+    [PCI_LI_01] = "Check Legacy Interrupt is SPI",
+    [PCI_LI_02] = "PCI legacy intr SPI ID unique",
+    [PCI_LI_03] = "Check Legacy Intr SPI level sensitive",
+    [PCI_MM_01] = "PCIe Device Memory mapping support",
+    [PCI_MM_03] = "PCIe Normal Memory mapping support",
+    [PCI_MM_04] = "NP type-1 pcie only support 32-bit",
+    [PCI_MM_05] = "PCIe & PE common physical memory view",
+    [PCI_MM_07] = "No extra address translation",
+    [PCI_MSI_1] = "Check MSI support for PCIe dev",
+    [PCI_MSI_2] = "Check MSI(X) vectors uniqueness",
+    [PCI_PAS_1] = "PASID support atleast 16 bits",
+    [PCI_PP_02] = "P2P transactions must not deadlock",
+    [PCI_PP_03] = "RP must suprt ACS if P2P Txn are allow",
+    [PCI_PP_04] = "Check P2P ACS Functionality",
+    [PCI_PP_05] = "Check Direct Transl P2P Support",
+    [PCI_SM_02] = "Check Function level reset",
+    [S_L4PCI_2] = "Check EA Capability",
+    [RE_ACS_1] = "Check ACS Cap on p2p support - RCiEP",
+    [RE_ACS_2] = "Check AER Cap on ACS Cap support - RCiEP",
+    [RI_BAR_1] = "Read and write to BAR reg - RCiEP, iEP Pair",
+    [RI_BAR_3] = "Check BAR memory space & type - RCiEP, iEP Pair",
+    [RI_INT_1] = "Check MSI and MSI-X support - RCiEP, iEP Pair",
+    [RI_ORD_1] = "Arrival order & Gathering Check - RCiEP, iEP EP",
+    [RE_ORD_4] = "Tx pending bit clear correctness - RCiEP",
+    [RE_PCI_1] = "Check Hdr type & link Cap - RCiEP, RCEC",
+    [RE_PCI_2] = "Check Class code and Ext Cap - RCEC",
+    [RI_PWR_1] = "Check Power Mgmt rules - RCiEP, iEP Pair",
+    [RE_REC_1] = "Check Dev Cap & Ctrl Reg rule - RCEC",
+    [RE_REG_1] = "Check config header rule - RCEC, RCiEP",
+    [RE_REG_2] = "Check PWR Mgmt Cap/Ctrl/Status - RCEC, RCiEP",
+    [RE_REG_3] = "Check Dev Cap & Ctrl Reg rule - RCiEP",
+    [RI_RST_1] = "Check Function level reset - RCiEP, iEP EP",
+    [RI_SMU_1] = "Check ATS Support Rule -  RCiEP, iEP Pair",
+    [RI_SMU_3] = "Generate PASID transactions - RCiEP, iEP EP",
+    [S_L6PCI_1] = "Check PCIe On-chip Peripherals",
+    [S_PCIe_02] = "Check RootPort P&NP Memory Access",
+    [S_PCIe_03] = "PE 2/4/8B writes to PCIe as 2/4/8B",
+    [S_PCIe_04] = "Check 2/4/8 Bytes targeted writes",
+    [S_PCIe_07] = "Check Inbound writes seen in order",
+    [S_PCIe_08] = "Check ordered writes flush prev writes",
+    [B_PCIe_10] = "Enable and disable STE.DCP bit",
+    [B_PCIe_11] = "Steering Tag value properties",
+    [BJLPB] = "Check MSI/MSI-X if FRS is supported",
+    [S_PCIe_10] = "STE.DCP control & Steering Tag properties",
+    /* MPAM */
+    [S_L7MP_01] = "Check for MPAM extension",
+    [S_L7MP_02] = "Check for MPAM partition IDs ",
+    [S_L7MP_03] = "Check MPAM LLC Requirements",
+    [S_L7MP_04] = "Check for MPAM LLC CSU Monitor count",
+    [S_L7MP_05] = "Check for MPAM MBWUs Monitor func",
+    [S_L7MP_08] = "Check for MPAM MSC address overlap",
+    /* ETE */
+    [ETE_02] = "Check for FEAT_ETE",
+    [ETE_03] = "Check trace unit ETE supports",
+    [ETE_04] = "Check ETE Same Trace Timestamp Source",
+    [ETE_05] = "Check Trace Same Timestamp Source",
+    [ETE_06] = "Check Concurrent Trace Generation",
+    [ETE_07] = "Check for FEAT_TRBE",
+    [ETE_08] = "Check trace buffers flag updates",
+    [ETE_09] = "Check TRBE trace buffers alignment",
+    [ETE_10] = "Check GICC TRBE Interrupt field",
+    /* PC-BSA rule test mapping */
+    [P_L1GI_01] = "Check GIC version",
+    [P_L1PP_01] = "Check All PPI Interrupt IDs",
+    [P_L1GI_03] = "Check GIC supports disabling LPIs",
+    [P_L1GI_04] = "Check GICR_PENDBASER when LPIs enabled",
+    [P_L1MM_01] = "NS-EL2 Stage-2 64KB Mapping Check",
+    [P_L1PE_01] = "Check PE 4KB Granule Support",
+    [P_L1PE_02] = "Check for 16-bit ASID support",
+    [P_L1PE_03] = "Check AARCH64 implementation",
+    [P_L1PE_04] = "Check for FEAT_LSE support",
+    [P_L1PE_05] = "Check FEAT_LPA Requirements",
+    [P_L1PE_06] = "Check DC CVAP support",
+    [P_L1PE_07] = "Check for 16-Bit VMID",
+    [P_L1PE_08] = "Check for Virtual host extensions",
+    [P_L1SM_02] = "Check Stage 1 SMMUv3 functionality",
+    [P_L1SM_03] = "Check Stage 2 SMMUv3 functionality",
+    [P_L1SM_04] = "Check SMMU Coherent Access Support",
+    [P_L1SM_05] = "Check if all DMA reqs behind SMMU",
+    [P_L2WD_01] = "Non-secure Generic watchdog check",
+    [P_L1TP_01] = "Check TPM Version",
+    [P_L1TP_03] = "Check TPM interface locality support",
+    [P_L1GI_02] = "Check all MSI(X) vectors are LPIs",
+    [P_L1PCI_2] = "Check EA Capability",
+    /* VBSA ACS entries */
+    [V_L1PE_01] = "Check vPE architectural compliance",
+    [V_L1PE_02] = "Check PMUv3 support in vPE",
+    [V_L1MM_01] = "Check VE Mem architectural compliance",
+    [V_L1MM_02] = "DMA requestors access to NS addr space",
+    [V_L1GI_01] = "Check vGIC architectural compliance",
+    [V_L1PP_00] = "Check VE PPI assignment mapping",
+    [V_L1SM_01] = "Check vSMMU architectural compliance",
+    [V_L1SM_02] = "Check SMMU stage 1 support for VE",
+    [V_L1TM_01] = "Check Virt and Phy counter presence",
+    [V_L1TM_02] = "Check Virt and Phy counter min freq",
+    [V_L1TM_04] = "Check uniform passage of time in VE",
+    [V_L1WK_02] = "Check power wakeup interrupts",
+    [V_L1WK_05] = "Check vPE power state semantics",
+    [V_L1PR_01] = "Check Peripheral arch compliance",
+    [V_L1PR_02] = "Check Virt PCIe arch compliance",
+    [V_L2PE_01] = "Check num PMU counters for vPEs",
+    [V_L2PE_02] = "Check vPE PMU overflow signal",
+    /* PFDI ACS entries */
+    [R0053] = "Check PFDI Version is returned",
+    [R0104] = "Check PFDI Version in All PE's",
+    [R0102] = "Check PFDI mandatory functions",
+    [R0060] = "Check PFDI Feature function support",
+    [R0066] = "Check PE HW test mechanism info",
+    [R0071] = "Check num of Test Part supported",
+    [R0076] = "Execute Test Parts and All Parts on PE",
+    [R0082] = "Query PE boot test status",
+    [R0089] = "Query PFDI firmware check on all PEs",
+    [R0156] = "PFDI reserved function support check",
+    [R0040] = "Check if X5 to X17 are preserved",
+    [R0099] = "PFDI forced error injection",
+    [R0164] = "Check PE Run with Start exceeds End",
+    [R0165] = "Check PE Run with Start exceeds max",
+    [R0100] = "PFDI recovery after forced error",
+    [R0157] = "Check PFDI feature for invalid function",
+    [R0154] = "Check PFDI unsupported function",
+    [R0166] = "Check PE Run with End exceeds max index",
+    [R0167] = "Check PE Run with Start or End equals -1",
+    [R0168] = "Check PE Run with Start or End less -1",
+    [R0155] = "PFDI version invalid params check",
+    [R0179] = "PFDI Feature invalid params check",
+    [R0158] = "PFDI PE Test ID invalid params check",
+    [R0160] = "PFDI Test Part Count invalid params",
+    [R0172] = "PFDI PE Test Result invalid params check",
+    [R0173] = "PFDI Firmware Check invalid params",
+    [R0193] = "Check FORCE ERROR overwrite behavior",
+    [R0194] = "Check FORCE ERROR PE locality behavior",
+    [R0163] = "PFDI Test Run invalid params check",
+    [R0180] = "PFDI Force Error invalid params check",
+    [R0176] = "PFDI Force Error invalid function ID check",
+    /* CXL */
+    [S_L8CXL_1] = "CXL Rules",
+    [CXL_01] = "Check CXL Version",
+    [CXL_02] = "Check CXL Type1/2 SMMU ATS",
+    [CXL_03] = "Check CHBCR address map",
+    [CXL_04] = "Validate CHBCR capability registers",
+    [CXL_05] = "CXL root port PMReq/PMRes VDM handling",
+    [CXL_06] = "CXL host sink for incoming MEFN VDM",
+    [CXL_09] = "CXL.mem write transaction",
+    [CXL_10] = "Check PCMO for CXL persistent memory",
+    [CXL_11] = "Check CXL.mem writeback and AER status",
+    [CXL_12] = "Check CXL.cache coherency with exerciser",
+    [CXL_13] = "Check CXL Type-3 mandatory atomic features",
+};
+
 /* Following structure maps test entry enums with entry function pointers
    Entries are guarded with TARGET_* macros to compile the entry functions based on test support
    for PAL for which compilation is carried out */
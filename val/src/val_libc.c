@@ -17,6 +17,147 @@
 
 #include "val_libc.h"
 
+/* Buffers are moved a 64-bit word at a time once both pointers are word
+   aligned, and in 64 byte blocks of LDP/STP pairs on AArch64. Only aligned
+   accesses are issued since the tree is built with -mstrict-align and some
+   buffers live in memory without caching. */
+#define LIBC_WORD_SIZE      8
+#define LIBC_BLOCK_SIZE     64
+#define LIBC_ONES           0x0101010101010101ull
+#define LIBC_HIGHS          0x8080808080808080ull
+
+/* Zero fills at least this large use DC ZVA when it is permitted */
+#define LIBC_ZVA_MIN_SIZE   4096
+
+#define LIBC_MISALIGN(p)    ((uint64_t)(p) & (LIBC_WORD_SIZE - 1))
+
+#if defined(__aarch64__)
+/**
+  @brief  Copy blocks of LIBC_BLOCK_SIZE bytes between word aligned buffers
+
+  @param  d       Destination, word aligned
+  @param  s       Source, word aligned
+  @param  blocks  Number of blocks to copy, must be non-zero
+
+  @return None
+**/
+static void libc_copy_blocks(uint64_t *d, const uint64_t *s, uint64_t blocks)
+{
+    __asm__ volatile(
+        "1:\n"
+        "ldp x4, x5, [%1], #16\n"
+        "ldp x6, x7, [%1], #16\n"
+        "ldp x8, x9, [%1], #16\n"
+        "ldp x10, x11, [%1], #16\n"
+        "stp x4, x5, [%0], #16\n"
+        "stp x6, x7, [%0], #16\n"
+        "stp x8, x9, [%0], #16\n"
+        "stp x10, x11, [%0], #16\n"
+        "subs %2, %2, #1\n"
+        "b.ne 1b\n"
+        : "+r" (d), "+r" (s), "+r" (blocks)
+        :
+        : "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11", "cc", "memory");
+}
+
+/**
+  @brief  Fill blocks of LIBC_BLOCK_SIZE bytes with a 64-bit pattern
+
+  @param  d        Destination, word aligned
+  @param  pattern  Value stored to every word
+  @param  blocks   Number of blocks to fill, must be non-zero
+
+  @return None
+**/
+static void libc_set_blocks(uint64_t *d, uint64_t pattern, uint64_t blocks)
+{
+    __asm__ volatile(
+        "1:\n"
+        "stp %2, %2, [%0], #16\n"
+        "stp %2, %2, [%0], #16\n"
+        "stp %2, %2, [%0], #16\n"
+        "stp %2, %2, [%0], #16\n"
+        "subs %1, %1, #1\n"
+        "b.ne 1b\n"
+        : "+r" (d), "+r" (blocks)
+        : "r" (pattern)
+        : "cc", "memory");
+}
+
+/**
+  @brief  Return the DC ZVA block size if zeroing by VA can be used
+
+  DC ZVA faults on memory that is not Normal cacheable, so it is only used
+  while the MMU and data cache are enabled at the current EL.
+
+  @return Block size in bytes, 0 if DC ZVA must not be used
+**/
+static uint64_t libc_zva_block_size(void)
+{
+    uint64_t el, sctlr, dczid;
+
+    __asm__ volatile("mrs %0, CurrentEL" : "=r" (el));
+    if (((el >> 2) & 0x3) == 2)
+        __asm__ volatile("mrs %0, sctlr_el2" : "=r" (sctlr));
+    else
+        __asm__ volatile("mrs %0, sctlr_el1" : "=r" (sctlr));
+
+    /* SCTLR.M (bit 0) and SCTLR.C (bit 2) */
+    if ((sctlr & 0x5) != 0x5)
+        return 0;
+
+    __asm__ volatile("mrs %0, dczid_el0" : "=r" (dczid));
+
+    /* DCZID_EL0.DZP prohibits DC ZVA, BS is log2 of the size in words */
+    if (dczid & (1ull << 4))
+        return 0;
+
+    return 4ull << (dczid & 0xF);
+}
+
+/**
+  @brief  Zero a buffer with DC ZVA
+
+  @param  d       Destination, aligned to the block size
+  @param  bs      DC ZVA block size in bytes
+  @param  blocks  Number of blocks to zero, must be non-zero
+
+  @return None
+**/
+static void libc_zva_blocks(unsigned char *d, uint64_t bs, uint64_t blocks)
+{
+    __asm__ volatile(
+        "1:\n"
+        "dc zva, %0\n"
+        "add %0, %0, %2\n"
+        "subs %1, %1, #1\n"
+        "b.ne 1b\n"
+        : "+r" (d), "+r" (blocks)
+        : "r" (bs)
+        : "cc", "memory");
+}
+#else
+static void libc_copy_blocks(uint64_t *d, const uint64_t *s, uint64_t blocks)
+{
+    uint32_t i;
+
+    while (blocks--) {
+        for (i = 0; i < LIBC_BLOCK_SIZE / LIBC_WORD_SIZE; i++)
+            *d++ = *s++;
+    }
+}
+
+static void libc_set_blocks(uint64_t *d, uint64_t pattern, uint64_t blocks)
+{
+    uint32_t i;
+
+    while (blocks--) {
+        for (i = 0; i < LIBC_BLOCK_SIZE / LIBC_WORD_SIZE; i++)
+            *d++ = pattern;
+    }
+}
+#endif
+
 /**
   @brief  Compare two memory buffers
 
@@ -32,6 +173,25 @@ int val_memory_compare(void *s1, void *s2, uint32_t len)
     const unsigned char *p1 = s1;
     const unsigned char *p2 = s2;
 
+    /* Words are only compared when both buffers share an alignment, the
+       first differing word is rescanned bytewise for the return value */
+    if ((len >= LIBC_WORD_SIZE) && (LIBC_MISALIGN(p1) == LIBC_MISALIGN(p2))) {
+        while (LIBC_MISALIGN(p1)) {
+            if (*p1 != *p2)
+                return (int)(*p1 - *p2);
+            p1++;
+            p2++;
+            len--;
+        }
+
+        while ((len >= LIBC_WORD_SIZE) &&
+               (*(const uint64_t *)p1 == *(const uint64_t *)p2)) {
+            p1 += LIBC_WORD_SIZE;
+            p2 += LIBC_WORD_SIZE;
+            len -= LIBC_WORD_SIZE;
+        }
+    }
+
     while (len--) {
         if (*p1 != *p2)
             return (int)(*p1 - *p2);
@@ -55,6 +215,27 @@ void *val_memcpy(void *dst, void *src, uint32_t len)
     const unsigned char *s = src;
     unsigned char *d = dst;
 
+    if ((len >= LIBC_WORD_SIZE) && (LIBC_MISALIGN(d) == LIBC_MISALIGN(s))) {
+        while (LIBC_MISALIGN(d)) {
+            *d++ = *s++;
+            len--;
+        }
+
+        if (len >= LIBC_BLOCK_SIZE) {
+            libc_copy_blocks((uint64_t *)d, (const uint64_t *)s, len / LIBC_BLOCK_SIZE);
+            d += len & ~(LIBC_BLOCK_SIZE - 1);
+            s += len & ~(LIBC_BLOCK_SIZE - 1);
+            len &= LIBC_BLOCK_SIZE - 1;
+        }
+
+        while (len >= LIBC_WORD_SIZE) {
+            *(uint64_t *)d = *(const uint64_t *)s;
+            d += LIBC_WORD_SIZE;
+            s += LIBC_WORD_SIZE;
+            len -= LIBC_WORD_SIZE;
+        }
+    }
+
     while (len--) {
         *d++ = *s++;
     }
@@ -74,6 +255,47 @@ void *val_memcpy(void *dst, void *src, uint32_t len)
 void val_memory_set(void *dst, uint32_t size, uint8_t value)
 {
     unsigned char *ptr = dst;
+    uint64_t pattern = LIBC_ONES * value;
+
+    if (size >= LIBC_WORD_SIZE) {
+        while (LIBC_MISALIGN(ptr)) {
+            *ptr++ = (unsigned char)value;
+            size--;
+        }
+
+#if defined(__aarch64__)
+        if ((value == 0) && (size >= LIBC_ZVA_MIN_SIZE)) {
+            uint64_t bs = libc_zva_block_size();
+
+            if (bs != 0) {
+                while ((uint64_t)ptr & (bs - 1)) {
+                    *(uint64_t *)ptr = 0;
+                    ptr += LIBC_WORD_SIZE;
+                    size -= LIBC_WORD_SIZE;
+                }
+
+                if (size >= bs) {
+                    libc_zva_blocks(ptr, bs, size / bs);
+                    ptr += size & ~(bs - 1);
+                    size &= bs - 1;
+                }
+            }
+        }
+#endif
+
+        if (size >= LIBC_BLOCK_SIZE) {
+            libc_set_blocks((uint64_t *)ptr, pattern, size / LIBC_BLOCK_SIZE);
+            ptr += size & ~(LIBC_BLOCK_SIZE - 1);
+            size &= LIBC_BLOCK_SIZE - 1;
+        }
+
+        while (size >= LIBC_WORD_SIZE) {
+            *(uint64_t *)ptr = pattern;
+            ptr += LIBC_WORD_SIZE;
+            size -= LIBC_WORD_SIZE;
+        }
+    }
+
     while (size--)
         *ptr++ = (unsigned char)value;
 
@@ -151,14 +373,30 @@ char *val_strcat(char *dest, const char *src, size_t output_buff_size)
 **/
 size_t val_strlen(char *str)
 {
-  size_t length = 0;
+  const char *p = str;
+  uint64_t word;
 
-  while (str[length] != '\0')
+  while (LIBC_MISALIGN(p))
   {
-    ++length;
+    if (*p == '\0')
+      return (size_t)(p - str);
+    ++p;
   }
 
-  return length;
+  /* An aligned word never crosses a page, so reading past the terminator
+     within the word is safe */
+  while (1)
+  {
+    word = *(const uint64_t *)p;
+    if ((word - LIBC_ONES) & ~word & LIBC_HIGHS)
+      break;
+    p += LIBC_WORD_SIZE;
+  }
+
+  while (*p != '\0')
+    ++p;
+
+  return (size_t)(p - str);
 }
 
 /**
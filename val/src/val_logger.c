@@ -6,22 +6,66 @@
  */
 
 #include "val_logger.h"
+#include "val_interface.h"
 
 enum { LOG_MAX_STRING_LENGTH = 90 };
 
-static bool collect_log_output;
-static char collected_log[LOG_MAX_STRING_LENGTH * 2];
-static size_t collected_log_len;
+/* PEs with an index of LOG_NUM_PE_LINES - 1 or more share the last line */
+#define LOG_NUM_PE_LINES 64
 
-static void val_putc(char c)
+/* Line being assembled by one PE, so that PEs printing at the same time do not
+   mix their characters or prefix state */
+typedef struct {
+    bool collect;               /* Characters go to buf while set */
+    bool mid_line;              /* Last message did not end the line */
+    bool prefix_printed;        /* Verbosity prefix of the line is out */
+    char prev;                  /* Last character, for the CR before LF */
+    size_t len;
+    char buf[LOG_MAX_STRING_LENGTH * 2];
+} log_line_t;
+
+static log_line_t log_lines[LOG_NUM_PE_LINES];
+
+/* Serialises val_printf() across PEs while val_log_set_shared() is enabled */
+static volatile uint32_t log_shared;
+static volatile uint32_t log_lock;
+
+/**
+ *   @brief    - Sends the collected characters to the console in one PAL call
+ *   @param    - line : Line of the printing PE
+ *   @return   - None
+ **/
+
+static void val_log_flush(log_line_t *line)
 {
-    if (collect_log_output) {
-        if (collected_log_len + 1 < sizeof(collected_log)) {
-            collected_log[collected_log_len++] = c;
-            collected_log[collected_log_len] = '\0';
-        }
+    if (line->len == 0)
         return;
-    }
+
+    line->buf[line->len] = '\0';
+    pal_print((uint64_t)(uintptr_t)line->buf);
+    line->len = 0;
+}
+
+/**
+ *   @brief    - Collects a character, the buffer is flushed when a line ends
+ *               or when it is full, so long messages are no longer cut short
+ *   @param    - line : Line of the printing PE
+ *             - c    : Input Character
+ *   @return   - None
+ **/
+
+static void val_putc(log_line_t *line, char c)
+{
+    if (!line->collect)
+        return;
+
+    if (line->len + 1 >= sizeof(line->buf))
+        val_log_flush(line);
+
+    line->buf[line->len++] = c;
+
+    if (c == '\n')
+        val_log_flush(line);
 }
 
 /* Keep fields aligned */
@@ -88,26 +132,25 @@ char log_buffer[LOG_BUFFER_SIZE];
 
 /**
  *   @brief    - Stores a character in a log buffer and outputs it via 'val_putc'
- *   @param    - c  : Input Character
+ *   @param    - line : Line of the printing PE
+ *             - c    : Input Character
  *   @return   - Sends the character using 'val_putc'
  **/
 
-static void log_putchar(char c)
+static void log_putchar(log_line_t *line, char c)
 {
-    static char prev;
-
     log_buffer[log_buffer_offset] = c;
     log_buffer_offset = (log_buffer_offset + 1) % LOG_BUFFER_SIZE;
 
     /* If we are about to print '\n' and the previous char wasn't '\r',
      * inject '\r' so UART terminals go back to column 0. */
-    if (c == '\n' && prev != '\r') {
+    if (c == '\n' && line->prev != '\r') {
         char cr = '\r';
-        val_putc(cr);
+        val_putc(line, cr);
     }
 
-    val_putc(c);
-    prev = c;
+    val_putc(line, c);
+    line->prev = c;
 }
 
 /**
@@ -139,12 +182,12 @@ static size_t log_strnlen_s(const char *str, size_t strsz)
  *   @return   - Number of characters written
  **/
 
-static size_t print_raw_string(const char *str)
+static size_t print_raw_string(log_line_t *line, const char *str)
 {
     const char *c = str;
 
     for (; *c != '\0'; c++) {
-        log_putchar(*c);
+        log_putchar(line, *c);
     }
 
     return (size_t)(c - str);
@@ -159,7 +202,7 @@ static size_t print_raw_string(const char *str)
  *             - fill       : The fill character
  *   @return   - Number of characters written
  **/
-static size_t print_string(const char *str, const char *suffix,
+static size_t print_string(log_line_t *line, const char *str, const char *suffix,
                int min_width, struct format_flags *flags,
                char fill)
 {
@@ -172,14 +215,14 @@ static size_t print_string(const char *str, const char *suffix,
         /* Left-aligned: prefix + suffix, then pad with spaces */
         while (str != suffix) {
             chars_written++;
-            log_putchar(*str++);
+            log_putchar(line, *str++);
         }
 
-        chars_written += print_raw_string(suffix);
+        chars_written += print_raw_string(line, suffix);
 
         while (total_len < (size_t)min_width) {
             chars_written++;
-            log_putchar(' ');
+            log_putchar(line, ' ');
             total_len++;
         }
         return chars_written;
@@ -190,32 +233,32 @@ static size_t print_string(const char *str, const char *suffix,
         /* Space padding goes BEFORE prefix/sign */
         while (total_len < (size_t)min_width) {
             chars_written++;
-            log_putchar(' ');
+            log_putchar(line, ' ');
             total_len++;
         }
 
         /* Now print prefix and suffix */
         while (str != suffix) {
             chars_written++;
-            log_putchar(*str++);
+            log_putchar(line, *str++);
         }
-        chars_written += print_raw_string(suffix);
+        chars_written += print_raw_string(line, suffix);
         return chars_written;
     }
 
     /* Zero padding (or other fill) goes AFTER prefix, BEFORE digits */
     while (str != suffix) {
         chars_written++;
-        log_putchar(*str++);
+        log_putchar(line, *str++);
     }
 
     while (total_len < (size_t)min_width) {
         chars_written++;
-        log_putchar(fill);
+        log_putchar(line, fill);
         total_len++;
     }
 
-    chars_written += print_raw_string(suffix);
+    chars_written += print_raw_string(line, suffix);
     return chars_written;
 }
 
@@ -228,8 +271,8 @@ static size_t print_string(const char *str, const char *suffix,
  *   @return   - Number of characters written
  **/
 
-static size_t print_int(size_t value, enum format_base base, int min_width,
-            struct format_flags *flags)
+static size_t print_int(log_line_t *line, size_t value, enum format_base base,
+            int min_width, struct format_flags *flags)
 {
     static const char *digits_lower = "0123456789abcdefxb";
     static const char *digits_upper = "0123456789ABCDEFXB";
@@ -281,7 +324,7 @@ static size_t print_int(size_t value, enum format_base base, int min_width,
     } else if (flags->space) {
         *--ptr = ' ';
     }
-    return print_string(ptr, num, min_width, flags, flags->zero ? '0' : ' ');
+    return print_string(line, ptr, num, min_width, flags, flags->zero ? '0' : ' ');
 }
 
 /**
@@ -482,7 +525,7 @@ static uint64_t reinterpret_signed_int(enum format_length length, uint64_t value
  *   @return   - Number of characters written, or `-1` if format string is invalid
  **/
 
-static int val_log(const char *fmt, va_list args)
+static int val_log(log_line_t *line, const char *fmt, va_list args)
 {
     int chars_written = 0;
 
@@ -490,7 +533,7 @@ static int val_log(const char *fmt, va_list args)
         switch (*fmt) {
         default:
             chars_written++;
-            log_putchar(*fmt);
+            log_putchar(line, *fmt);
             fmt++;
             break;
 
@@ -515,14 +558,14 @@ static int val_log(const char *fmt, va_list args)
             case '%':
                 fmt++;
                 chars_written++;
-                log_putchar('%');
+                log_putchar(line, '%');
                 break;
 
             case 'c': {
                 char str[2] = {(char)va_arg(args, int), 0};
 
                 fmt++;
-                chars_written += print_string(
+                chars_written += print_string(line,
                     str, str, min_width, &flags, ' ');
                 break;
             }
@@ -533,7 +576,7 @@ static int val_log(const char *fmt, va_list args)
                     str = "(null)";
 
                 fmt++;
-                chars_written += print_string(
+                chars_written += print_string(line,
                     str, str, min_width, &flags, ' ');
                 break;
             }
@@ -551,7 +594,7 @@ static int val_log(const char *fmt, va_list args)
                 value = reinterpret_signed_int(length, value,
                                    &flags);
 
-                chars_written += print_int(value, base10,
+                chars_written += print_int(line, value, base10,
                                min_width, &flags);
                 break;
             }
@@ -567,7 +610,7 @@ static int val_log(const char *fmt, va_list args)
                  }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base2,
+                chars_written += print_int(line, value, base2,
                                min_width, &flags);
                 break;
 
@@ -583,7 +626,7 @@ static int val_log(const char *fmt, va_list args)
                 }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base2,
+                chars_written += print_int(line, value, base2,
                                min_width, &flags);
                 break;
 
@@ -598,7 +641,7 @@ static int val_log(const char *fmt, va_list args)
                 }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base8,
+                chars_written += print_int(line, value, base8,
                                min_width, &flags);
                 break;
 
@@ -613,7 +656,7 @@ static int val_log(const char *fmt, va_list args)
                 }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base16,
+                chars_written += print_int(line, value, base16,
                                min_width, &flags);
                 break;
 
@@ -629,7 +672,7 @@ static int val_log(const char *fmt, va_list args)
                 }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base16,
+                chars_written += print_int(line, value, base16,
                                min_width, &flags);
                 break;
 
@@ -644,7 +687,7 @@ static int val_log(const char *fmt, va_list args)
                 }
                 value = reinterpret_unsigned_int(length, value);
 
-                chars_written += print_int(value, base10,
+                chars_written += print_int(line, value, base10,
                                min_width, &flags);
                 break;
 
@@ -655,7 +698,7 @@ static int val_log(const char *fmt, va_list args)
                 flags.zero = true;
                 flags.alt = true;
 
-                chars_written += print_int(value, base16,
+                chars_written += print_int(line, value, base16,
                                min_width, &flags);
                 break;
 
@@ -672,82 +715,72 @@ out:
 }
 
 /**
- *   @brief    - This function prints the given string and data onto the uart
- *   @param    - verbosity  : Print Verbosity level
+ *   @brief    - Formats one message into the line buffer and flushes it
+ *   @param    - line       : Line of the printing PE
+ *             - verbosity  : Print Verbosity level
  *             - msg        : Input String
- *             - ...        : ellipses for variadic args
+ *             - args       : Variadic args of the message
  *   @return   - SUCCESS((Any positive number for character written)/FAILURE(0)
  **/
 
-uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
+static uint32_t val_vprintf(log_line_t *line, print_verbosity_t verbosity, const char *msg,
+                            va_list args)
 {
     int chars_written = 0;
-    static bool lastWasNewline = true;
-    static bool prefixPrinted;
     char formatted_msg[LOG_MAX_STRING_LENGTH];
-    va_list args;
-
-    if (msg == NULL)
-        return 0;
 
-    collect_log_output = true;
-    collected_log_len = 0;
-    collected_log[0] = '\0';
+    line->collect = true;
 
     /* New line => allow prefix again */
-    if (lastWasNewline)
-        prefixPrinted = false;
+    if (!line->mid_line)
+        line->prefix_printed = false;
 
     /* Emit any leading blank lines cleanly (and don't prefix blank lines) */
     while (*msg == '\n') {
-        print_raw_string("\r\n");
-        lastWasNewline = true;
-        prefixPrinted  = false;
+        print_raw_string(line, "\r\n");
+        line->mid_line = false;
+        line->prefix_printed = false;
         msg++;
     }
 
     /* If msg was only newlines */
     if (*msg == '\0') {
-        collect_log_output = false;
-        if (collected_log_len > 0)
-            pal_print((uint64_t)(uintptr_t)collected_log);
+        line->collect = false;
         return 0;
     }
 
     /* Print prefix exactly once per logical line (supports multi-call line assembly) */
-    if (!prefixPrinted) {
+    if (!line->prefix_printed) {
         switch (verbosity)
         {
             case TRACE:
-                 print_raw_string("\t");
+                 print_raw_string(line, "\t");
                  break;
             case DEBUG:
-                 print_raw_string("\t");
+                 print_raw_string(line, "\t");
                  break;
             case INFO:
-                 print_raw_string("");
+                 print_raw_string(line, "");
                  break;
             case WARN:
-                 print_raw_string("\tWARN : ");
+                 print_raw_string(line, "\tWARN : ");
                  break;
             case ERROR:
-                 print_raw_string("\tERROR: ");
+                 print_raw_string(line, "\tERROR: ");
                  break;
             case FATAL:
-                 print_raw_string("\tFATAL: ");
+                 print_raw_string(line, "\tFATAL: ");
                  break;
             default:
                  break;
         }
-        prefixPrinted = true;
+        line->prefix_printed = true;
     }
 
     /* Bounded scan: we only safely inspect up to N-2 chars */
     const size_t max_scan = LOG_MAX_STRING_LENGTH - 2;
     size_t len = log_strnlen_s(msg, max_scan);
 
-    va_start(args, msg);
-
     /*
      * 3 cases:
      *  A) msg ends with '\n' convert final LF to CRLF
@@ -763,9 +796,9 @@ uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
         formatted_msg[len]     = '\n';
         formatted_msg[len + 1] = '\0';
 
-        chars_written = val_log(formatted_msg, args);
-        lastWasNewline = true;
-        prefixPrinted  = false;
+        chars_written = val_log(line, formatted_msg, args);
+        line->mid_line = false;
+        line->prefix_printed = false;
     }
     /* Case B: likely truncated (no '\0' found within max_scan) */
     else if (len == max_scan)
@@ -782,34 +815,87 @@ uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
         formatted_msg[perm_len] = '\0';
 
         if (perm_len > 0)
-            chars_written += (int)print_raw_string(formatted_msg);
+            chars_written += (int)print_raw_string(line, formatted_msg);
 
-        chars_written += (int)print_raw_string(trunc_msg);
+        chars_written += (int)print_raw_string(line, trunc_msg);
 
-        lastWasNewline = true;
-        prefixPrinted  = false;  /* next line should get prefix */
+        line->mid_line = false;
+        line->prefix_printed = false;  /* next line should get prefix */
      }
 
     /* Case C: short, no trailing '\n' */
     else
     {
-        chars_written = val_log(msg, args);
-        lastWasNewline = false;
+        chars_written = val_log(line, msg, args);
+        line->mid_line = true;
     }
 
-    va_end(args);
+    line->collect = false;
 
-    collect_log_output = false;
+    /* Messages mostly start rather than end with '\n', so the text after the
+       last line break is not held back for the next call */
+    val_log_flush(line);
 
     if (chars_written < 0)
     return 0;
 
-    if (collected_log_len > 0)
-        pal_print((uint64_t)(uintptr_t)collected_log);
-
     return (uint32_t)chars_written;
 }
 
+/**
+ *   @brief    - Enables or disables serialisation of val_printf() across PEs.
+ *               Callers enable it only while the MMU and caches are on and
+ *               other PEs may print, such as the parallel rule scheduler.
+ *   @param    - shared  : true while more than one PE may print
+ *   @return   - None
+ **/
+
+void val_log_set_shared(bool shared)
+{
+    log_shared = shared;
+}
+
+/**
+ *   @brief    - This function prints the given string and data onto the uart
+ *   @param    - verbosity  : Print Verbosity level
+ *             - msg        : Input String
+ *             - ...        : ellipses for variadic args
+ *   @return   - SUCCESS((Any positive number for character written)/FAILURE(0)
+ **/
+
+uint32_t val_printf(print_verbosity_t verbosity, const char *msg, ...)
+{
+    uint32_t chars_written;
+    uint32_t locked = log_shared;
+    uint32_t index = 0;
+    log_line_t *line;
+    va_list args;
+
+    if (msg == NULL)
+        return 0;
+
+    /* Messages printed before the PE table exists come from the primary PE */
+    if (val_pe_get_num() != 0)
+        index = val_pe_get_index_mpid(val_pe_get_mpid());
+
+    line = &log_lines[(index < LOG_NUM_PE_LINES) ? index : (LOG_NUM_PE_LINES - 1)];
+
+    /* A message is never split by another PE's output */
+    if (locked) {
+        while (__atomic_exchange_n(&log_lock, 1, __ATOMIC_ACQUIRE))
+            ;
+    }
+
+    va_start(args, msg);
+    chars_written = val_vprintf(line, verbosity, msg, args);
+    va_end(args);
+
+    if (locked)
+        __atomic_store_n(&log_lock, 0, __ATOMIC_RELEASE);
+
+    return chars_written;
+}
+
 /**
   @brief  Copy memory from source to destination
 
@@ -16,12 +16,131 @@
 
 #include "include/val_interface.h"
 #include "include/val_status.h"
+#include "include/acs_common.h"
+#include "include/val_sysreg.h"
+#include "include/acs_val.h"
+#include "include/acs_pe.h"
 #include "val_logger.h"
 
-/* Map shared memory as an array of status records */
-static inline volatile val_test_status_t *val_get_shared_address(void)
+/* Status record of a PE, in the shared memory slot of that PE */
+static inline volatile val_test_status_t *val_get_shared_address(uint32_t index)
 {
-    return (volatile val_test_status_t *)val_get_status_region_base();
+    return (volatile val_test_status_t *)val_get_status_slot(index);
+}
+
+/**
+ * @brief Whether the pending bitmap is updated with atomics.
+ *
+ * Exclusive accesses need Normal cacheable memory, so with the MMU or data
+ * cache off, or with a single PE, plain stores are used instead.
+ *
+ * @return true if other PEs may update the bitmap and atomics are usable.
+ */
+static bool val_pending_use_atomics(void)
+{
+    uint64_t sctlr;
+
+    if (val_pe_get_num() < 2)
+        return false;
+
+    if (val_pe_reg_read(CurrentEL) == AARCH64_EL2)
+        sctlr = val_pe_reg_read(SCTLR_EL2);
+    else
+        sctlr = val_pe_reg_read(SCTLR_EL1);
+
+    /* SCTLR.M (bit 0) and SCTLR.C (bit 2) */
+    return (sctlr & 0x5) == 0x5;
+}
+
+/**
+ * @brief Marks a PE as pending or done in the shared pending bitmap.
+ *
+ * PEs sharing a bitmap word update it concurrently, hence the atomics.
+ * The pending count follows the bitmap, the PE which brings it to zero
+ * wakes PEs waiting in val_wait_for_test_completion() with SEV. The
+ * release orders the status record before both updates.
+ *
+ * @param index    PE index.
+ * @param pending  Whether the status of the PE is pending.
+ */
+static void val_update_pending(uint32_t index, bool pending)
+{
+    volatile uint64_t *count = val_get_pending_count();
+    volatile uint64_t *word = val_get_pending_bitmap() + (index / 64);
+    uint64_t bit = 1ull << (index % 64);
+    uint64_t old;
+    bool woken = false;
+
+    if (!val_pending_use_atomics()) {
+        old = *word;
+        if (pending && !(old & bit)) {
+            *word = old | bit;
+            *count += 1;
+        } else if (!pending && (old & bit)) {
+            *word = old & ~bit;
+            *count -= 1;
+            woken = (*count == 0);
+        }
+    } else if (pending) {
+        old = __atomic_fetch_or(word, bit, __ATOMIC_RELEASE);
+        if (!(old & bit))
+            __atomic_fetch_add(count, 1, __ATOMIC_RELEASE);
+    } else {
+        old = __atomic_fetch_and(word, ~bit, __ATOMIC_RELEASE);
+        if (old & bit)
+            woken = (__atomic_sub_fetch(count, 1, __ATOMIC_RELEASE) == 0);
+    }
+
+    val_data_cache_ops_by_va((addr_t)word, CLEAN_AND_INVALIDATE);
+    val_data_cache_ops_by_va((addr_t)count, CLEAN_AND_INVALIDATE);
+
+    if (woken) {
+        dsbish();
+        sev();
+    }
+}
+
+/**
+ * @brief Clears the pending bits of the PEs of a timed out test.
+ *
+ * PEs which never reported would otherwise keep the count above zero for
+ * every later test. Only the bits of PEs 0 to num_pe - 1 are cleared and
+ * the count drops by exactly the number of bits cleared, so PEs outside
+ * the test keep their state. A late report from a cleared PE finds its
+ * bit clear and leaves the count alone.
+ *
+ * @param num_pe  Number of PEs executing the test.
+ */
+void val_reset_pending(uint32_t num_pe)
+{
+    volatile uint64_t *count = val_get_pending_count();
+    volatile uint64_t *bitmap = val_get_pending_bitmap();
+    bool atomics = val_pending_use_atomics();
+    uint64_t mask, old, cleared = 0;
+    uint32_t i;
+
+    for (i = 0; i < (num_pe + 63) / 64; i++) {
+        mask = ((i == (num_pe - 1) / 64) && (num_pe % 64)) ?
+               ((1ull << (num_pe % 64)) - 1) : ~0ull;
+
+        if (atomics) {
+            old = __atomic_fetch_and(&bitmap[i], ~mask, __ATOMIC_RELEASE);
+        } else {
+            old = bitmap[i];
+            bitmap[i] = old & ~mask;
+        }
+        cleared += __builtin_popcountll(old & mask);
+        val_data_cache_ops_by_va((addr_t)&bitmap[i], CLEAN_AND_INVALIDATE);
+    }
+
+    if (!cleared)
+        return;
+
+    if (atomics)
+        __atomic_sub_fetch(count, cleared, __ATOMIC_RELEASE);
+    else
+        *count -= cleared;
+    val_data_cache_ops_by_va((addr_t)count, CLEAN_AND_INVALIDATE);
 }
 
 /**
@@ -35,17 +154,19 @@ static inline volatile val_test_status_t *val_get_shared_address(void)
  */
 void val_set_status(uint32_t index, uint32_t test_res)
 {
-    volatile val_test_status_t *mem = val_get_shared_address();
+    volatile val_test_status_t *mem;
 
     if (index >= val_pe_get_num()) {
         val_print(ERROR, "val_set_status: invalid PE index %u\n",
                   (unsigned int)index);
         return;
     }
-    mem[index].index = index;
-    mem[index].state = (uint8_t)GET_STATE(test_res);
-    mem[index].status_code = (uint16_t)GET_CODE(test_res);
-    val_data_cache_ops_by_va((addr_t)&mem[index], CLEAN_AND_INVALIDATE);
+    mem = val_get_shared_address(index);
+    mem->index = index;
+    mem->state = (uint8_t)GET_STATE(test_res);
+    mem->status_code = (uint16_t)GET_CODE(test_res);
+    val_data_cache_ops_by_va((addr_t)mem, CLEAN_AND_INVALIDATE);
+    val_update_pending(index, GET_STATE(test_res) == TEST_PENDING_VAL);
 }
 
 /**
@@ -60,15 +181,16 @@ void val_set_status(uint32_t index, uint32_t test_res)
  */
 uint32_t val_get_status(uint32_t index)
 {
-    volatile val_test_status_t *mem = val_get_shared_address();
+    volatile val_test_status_t *mem;
 
     if (index >= val_pe_get_num()) {
         val_print(ERROR, "val_get_status: invalid PE index %u\n",
                   (unsigned int)index);
         return RESULT_UNKNOWN;
     }
-    val_data_cache_ops_by_va((addr_t)&mem[index], INVALIDATE);
-    return GENERATE_TEST_RESULT(mem[index].state, mem[index].status_code);
+    mem = val_get_shared_address(index);
+    val_data_cache_ops_by_va((addr_t)mem, INVALIDATE);
+    return GENERATE_TEST_RESULT(mem->state, mem->status_code);
 }
 
 /**